@@ -0,0 +1,383 @@
+#pragma once
+
+#include "setup.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#	include "../simd/common.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+	// Lane types for the array functions (perlinArray, fastSinArray, ...).
+	// Kernels are templates over the lane type, so one source gives the
+	// portable float path, lanes4 (SSE2) and lanes8 (AVX); lanes is the widest
+	// one enabled. Comparisons return lane_mask<V>::type, which is bool for
+	// float and a bit mask in a register otherwise. min, max and the
+	// comparisons follow the SSE rules for NaN operands on every lane type;
+	// lane_fma only fuses where GLM_SIMD_FMA is set. lane_load4/lane_load3
+	// and the matching stores move lane_count records of 4 or 3 floats between
+	// memory and one lane value per component.
+
+	template<typename V>
+	struct lane_mask
+	{
+		typedef V type;
+	};
+
+	template<>
+	struct lane_mask<float>
+	{
+		typedef bool type;
+	};
+
+	GLM_FUNC_QUALIFIER unsigned int lane_bits(float x)
+	{
+		unsigned int i;
+		std::memcpy(&i, &x, sizeof(i));
+		return i;
+	}
+
+	GLM_FUNC_QUALIFIER float lane_from_bits(unsigned int i)
+	{
+		float x;
+		std::memcpy(&x, &i, sizeof(x));
+		return x;
+	}
+
+	template<typename V>
+	V lane_load(float const* p);
+
+	template<>
+	GLM_FUNC_QUALIFIER float lane_load<float>(float const* p) { return *p; }
+	GLM_FUNC_QUALIFIER void lane_store(float* p, float v) { *p = v; }
+
+	GLM_FUNC_QUALIFIER void lane_load4(float const* p, float& a, float& b, float& c, float& d) { a = p[0]; b = p[1]; c = p[2]; d = p[3]; }
+	GLM_FUNC_QUALIFIER void lane_store4(float* p, float a, float b, float c, float d) { p[0] = a; p[1] = b; p[2] = c; p[3] = d; }
+	GLM_FUNC_QUALIFIER void lane_load3(float const* p, float& a, float& b, float& c) { a = p[0]; b = p[1]; c = p[2]; }
+	GLM_FUNC_QUALIFIER void lane_store3(float* p, float a, float b, float c) { p[0] = a; p[1] = b; p[2] = c; }
+
+	GLM_FUNC_QUALIFIER float lane_fma(float a, float b, float c) { return a * b + c; }
+	GLM_FUNC_QUALIFIER float lane_floor(float x) { return std::floor(x); }
+	GLM_FUNC_QUALIFIER float lane_abs(float x) { return std::fabs(x); }
+	GLM_FUNC_QUALIFIER float lane_sqrt(float x) { return std::sqrt(x); }
+	GLM_FUNC_QUALIFIER float lane_min(float a, float b) { return a < b ? a : b; }
+	GLM_FUNC_QUALIFIER float lane_max(float a, float b) { return a > b ? a : b; }
+
+	GLM_FUNC_QUALIFIER bool lane_gt(float a, float b) { return a > b; }
+	GLM_FUNC_QUALIFIER bool lane_ge(float a, float b) { return a >= b; }
+	GLM_FUNC_QUALIFIER bool lane_lt(float a, float b) { return a < b; }
+	GLM_FUNC_QUALIFIER bool lane_le(float a, float b) { return a <= b; }
+	GLM_FUNC_QUALIFIER bool lane_eq(float a, float b) { return a == b; }
+	GLM_FUNC_QUALIFIER bool lane_neq(float a, float b) { return a != b; }
+	GLM_FUNC_QUALIFIER bool lane_signbit(float x) { return (lane_bits(x) >> 31) != 0; }
+
+	GLM_FUNC_QUALIFIER bool lane_and(bool a, bool b) { return a && b; }
+	GLM_FUNC_QUALIFIER bool lane_or(bool a, bool b) { return a || b; }
+	GLM_FUNC_QUALIFIER bool lane_andnot(bool a, bool b) { return !a && b; }
+
+	// Branch free, the lanes of an array rarely agree.
+	GLM_FUNC_QUALIFIER float lane_select(bool m, float t, float f)
+	{
+		unsigned int const k = 0u - static_cast<unsigned int>(m);
+		return lane_from_bits((lane_bits(t) & k) | (lane_bits(f) & ~k));
+	}
+
+	// x with its sign flipped where s is negative.
+	GLM_FUNC_QUALIFIER float lane_xorsign(float x, float s) { return lane_from_bits(lane_bits(x) ^ (lane_bits(s) & 0x80000000u)); }
+
+	// 2^n for integral n in [-126, 127].
+	GLM_FUNC_QUALIFIER float lane_pow2i(float n) { return lane_from_bits(static_cast<unsigned int>(static_cast<int>(n) + 127) << 23); }
+
+	// Splits a positive normal x into a significand in [0.5, 1) and an exponent, like frexp.
+	GLM_FUNC_QUALIFIER float lane_frexp(float x, float& e)
+	{
+		unsigned int const i = lane_bits(x);
+		e = static_cast<float>(static_cast<int>(i >> 23) - 126);
+		return lane_from_bits((i & 0x807fffffu) | 0x3f000000u);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	struct lanes4
+	{
+		glm_vec4 data;
+
+		lanes4() {}
+		lanes4(glm_vec4 v) : data(v) {}
+		lanes4(float s) : data(_mm_set1_ps(s)) {}
+	};
+
+	GLM_FUNC_QUALIFIER lanes4 operator+(lanes4 a, lanes4 b) { return _mm_add_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 operator-(lanes4 a, lanes4 b) { return _mm_sub_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 operator*(lanes4 a, lanes4 b) { return _mm_mul_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 operator/(lanes4 a, lanes4 b) { return _mm_div_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 operator-(lanes4 a) { return _mm_xor_ps(a.data, _mm_set1_ps(-0.0f)); }
+
+	template<>
+	GLM_FUNC_QUALIFIER lanes4 lane_load<lanes4>(float const* p) { return _mm_loadu_ps(p); }
+	GLM_FUNC_QUALIFIER void lane_store(float* p, lanes4 v) { _mm_storeu_ps(p, v.data); }
+
+	GLM_FUNC_QUALIFIER void lane_load4(float const* p, lanes4& a, lanes4& b, lanes4& c, lanes4& d)
+	{
+		__m128 r0 = _mm_loadu_ps(p), r1 = _mm_loadu_ps(p + 4), r2 = _mm_loadu_ps(p + 8), r3 = _mm_loadu_ps(p + 12);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		a = r0; b = r1; c = r2; d = r3;
+	}
+
+	GLM_FUNC_QUALIFIER void lane_store4(float* p, lanes4 a, lanes4 b, lanes4 c, lanes4 d)
+	{
+		_MM_TRANSPOSE4_PS(a.data, b.data, c.data, d.data);
+		_mm_storeu_ps(p, a.data); _mm_storeu_ps(p + 4, b.data); _mm_storeu_ps(p + 8, c.data); _mm_storeu_ps(p + 12, d.data);
+	}
+
+	GLM_FUNC_QUALIFIER void lane_load3(float const* p, lanes4& a, lanes4& b, lanes4& c)
+	{
+		// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 -> one record per register, then transpose.
+		__m128 const r0 = _mm_loadu_ps(p), r1 = _mm_loadu_ps(p + 4), r2 = _mm_loadu_ps(p + 8);
+		__m128 const t = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(1, 0, 3, 3));
+		__m128 v0 = r0;
+		__m128 v1 = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 2, 0));
+		__m128 v2 = _mm_shuffle_ps(r1, r2, _MM_SHUFFLE(0, 0, 3, 2));
+		__m128 v3 = _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 2, 1));
+		_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+		a = v0; b = v1; c = v2;
+	}
+
+	GLM_FUNC_QUALIFIER void lane_store3(float* p, lanes4 a, lanes4 b, lanes4 c)
+	{
+		__m128 v3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(a.data, b.data, c.data, v3);
+		__m128 const t0 = _mm_shuffle_ps(a.data, b.data, _MM_SHUFFLE(0, 0, 2, 2));
+		__m128 const t1 = _mm_shuffle_ps(c.data, v3, _MM_SHUFFLE(0, 0, 2, 2));
+		_mm_storeu_ps(p, _mm_shuffle_ps(a.data, t0, _MM_SHUFFLE(2, 0, 1, 0)));
+		_mm_storeu_ps(p + 4, _mm_shuffle_ps(b.data, c.data, _MM_SHUFFLE(1, 0, 2, 1)));
+		_mm_storeu_ps(p + 8, _mm_shuffle_ps(t1, v3, _MM_SHUFFLE(2, 1, 2, 0)));
+	}
+
+	GLM_FUNC_QUALIFIER lanes4 lane_fma(lanes4 a, lanes4 b, lanes4 c) { return glm_vec4_fma(a.data, b.data, c.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_floor(lanes4 x) { return glm_vec4_floor(x.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_abs(lanes4 x) { return glm_vec4_abs(x.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_sqrt(lanes4 x) { return _mm_sqrt_ps(x.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_min(lanes4 a, lanes4 b) { return _mm_min_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_max(lanes4 a, lanes4 b) { return _mm_max_ps(a.data, b.data); }
+
+	GLM_FUNC_QUALIFIER lanes4 lane_gt(lanes4 a, lanes4 b) { return _mm_cmpgt_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_ge(lanes4 a, lanes4 b) { return _mm_cmpge_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_lt(lanes4 a, lanes4 b) { return _mm_cmplt_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_le(lanes4 a, lanes4 b) { return _mm_cmple_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_eq(lanes4 a, lanes4 b) { return _mm_cmpeq_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_neq(lanes4 a, lanes4 b) { return _mm_cmpneq_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_signbit(lanes4 x) { return _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x.data), 31)); }
+
+	GLM_FUNC_QUALIFIER lanes4 lane_and(lanes4 a, lanes4 b) { return _mm_and_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_or(lanes4 a, lanes4 b) { return _mm_or_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_andnot(lanes4 a, lanes4 b) { return _mm_andnot_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_select(lanes4 m, lanes4 t, lanes4 f)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return _mm_blendv_ps(f.data, t.data, m.data);
+#		else
+			return _mm_or_ps(_mm_and_ps(m.data, t.data), _mm_andnot_ps(m.data, f.data));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER lanes4 lane_xorsign(lanes4 x, lanes4 s) { return _mm_xor_ps(x.data, _mm_and_ps(s.data, _mm_set1_ps(-0.0f))); }
+
+	GLM_FUNC_QUALIFIER lanes4 lane_pow2i(lanes4 n)
+	{
+		__m128i const e = _mm_add_epi32(_mm_cvttps_epi32(n.data), _mm_set1_epi32(127));
+		return _mm_castsi128_ps(_mm_slli_epi32(e, 23));
+	}
+
+	GLM_FUNC_QUALIFIER lanes4 lane_frexp(lanes4 x, lanes4& e)
+	{
+		__m128i const i = _mm_castps_si128(x.data);
+		e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(i, 23), _mm_set1_epi32(126)));
+		__m128i const m = _mm_and_si128(i, _mm_set1_epi32(static_cast<int>(0x807fffffu)));
+		return _mm_castsi128_ps(_mm_or_si128(m, _mm_set1_epi32(0x3f000000)));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	struct lanes8
+	{
+		__m256 data;
+
+		lanes8() {}
+		lanes8(__m256 v) : data(v) {}
+		lanes8(float s) : data(_mm256_set1_ps(s)) {}
+	};
+
+	GLM_FUNC_QUALIFIER lanes8 operator+(lanes8 a, lanes8 b) { return _mm256_add_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 operator-(lanes8 a, lanes8 b) { return _mm256_sub_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 operator*(lanes8 a, lanes8 b) { return _mm256_mul_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 operator/(lanes8 a, lanes8 b) { return _mm256_div_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 operator-(lanes8 a) { return _mm256_xor_ps(a.data, _mm256_set1_ps(-0.0f)); }
+
+	template<>
+	GLM_FUNC_QUALIFIER lanes8 lane_load<lanes8>(float const* p) { return _mm256_loadu_ps(p); }
+	GLM_FUNC_QUALIFIER void lane_store(float* p, lanes8 v) { _mm256_storeu_ps(p, v.data); }
+
+	GLM_FUNC_QUALIFIER lanes4 lane_low(lanes8 x) { return _mm256_castps256_ps128(x.data); }
+	GLM_FUNC_QUALIFIER lanes4 lane_high(lanes8 x) { return _mm256_extractf128_ps(x.data, 1); }
+	GLM_FUNC_QUALIFIER lanes8 lane_combine(lanes4 lo, lanes4 hi) { return _mm256_insertf128_ps(_mm256_castps128_ps256(lo.data), hi.data, 1); }
+
+	// Transposes within each 128-bit half; the halves hold records 0-3 and 4-7.
+	GLM_FUNC_QUALIFIER void lane_transpose4(lanes8& a, lanes8& b, lanes8& c, lanes8& d)
+	{
+		__m256 const t0 = _mm256_unpacklo_ps(a.data, b.data);
+		__m256 const t1 = _mm256_unpackhi_ps(a.data, b.data);
+		__m256 const t2 = _mm256_unpacklo_ps(c.data, d.data);
+		__m256 const t3 = _mm256_unpackhi_ps(c.data, d.data);
+		a = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+		b = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+		c = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		d = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	GLM_FUNC_QUALIFIER void lane_load4(float const* p, lanes8& a, lanes8& b, lanes8& c, lanes8& d)
+	{
+		a = lane_combine(_mm_loadu_ps(p), _mm_loadu_ps(p + 16));
+		b = lane_combine(_mm_loadu_ps(p + 4), _mm_loadu_ps(p + 20));
+		c = lane_combine(_mm_loadu_ps(p + 8), _mm_loadu_ps(p + 24));
+		d = lane_combine(_mm_loadu_ps(p + 12), _mm_loadu_ps(p + 28));
+		lane_transpose4(a, b, c, d);
+	}
+
+	GLM_FUNC_QUALIFIER void lane_store4(float* p, lanes8 a, lanes8 b, lanes8 c, lanes8 d)
+	{
+		lane_transpose4(a, b, c, d);
+		_mm_storeu_ps(p, lane_low(a).data); _mm_storeu_ps(p + 16, lane_high(a).data);
+		_mm_storeu_ps(p + 4, lane_low(b).data); _mm_storeu_ps(p + 20, lane_high(b).data);
+		_mm_storeu_ps(p + 8, lane_low(c).data); _mm_storeu_ps(p + 24, lane_high(c).data);
+		_mm_storeu_ps(p + 12, lane_low(d).data); _mm_storeu_ps(p + 28, lane_high(d).data);
+	}
+
+	GLM_FUNC_QUALIFIER void lane_load3(float const* p, lanes8& a, lanes8& b, lanes8& c)
+	{
+		// Same shuffles as the lanes4 version, on records 0-3 and 4-7 in the two halves.
+		__m256 const r0 = lane_combine(_mm_loadu_ps(p), _mm_loadu_ps(p + 12)).data;
+		__m256 const r1 = lane_combine(_mm_loadu_ps(p + 4), _mm_loadu_ps(p + 16)).data;
+		__m256 const r2 = lane_combine(_mm_loadu_ps(p + 8), _mm_loadu_ps(p + 20)).data;
+		__m256 const t = _mm256_shuffle_ps(r0, r1, _MM_SHUFFLE(1, 0, 3, 3));
+		lanes8 v0 = r0;
+		lanes8 v1 = _mm256_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 2, 0));
+		lanes8 v2 = _mm256_shuffle_ps(r1, r2, _MM_SHUFFLE(0, 0, 3, 2));
+		lanes8 v3 = _mm256_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 2, 1));
+		lane_transpose4(v0, v1, v2, v3);
+		a = v0; b = v1; c = v2;
+	}
+
+	GLM_FUNC_QUALIFIER void lane_store3(float* p, lanes8 a, lanes8 b, lanes8 c)
+	{
+		lanes8 v3 = _mm256_setzero_ps();
+		lane_transpose4(a, b, c, v3);
+		__m256 const t0 = _mm256_shuffle_ps(a.data, b.data, _MM_SHUFFLE(0, 0, 2, 2));
+		__m256 const t1 = _mm256_shuffle_ps(c.data, v3.data, _MM_SHUFFLE(0, 0, 2, 2));
+		lanes8 const r0 = _mm256_shuffle_ps(a.data, t0, _MM_SHUFFLE(2, 0, 1, 0));
+		lanes8 const r1 = _mm256_shuffle_ps(b.data, c.data, _MM_SHUFFLE(1, 0, 2, 1));
+		lanes8 const r2 = _mm256_shuffle_ps(t1, v3.data, _MM_SHUFFLE(2, 1, 2, 0));
+		_mm_storeu_ps(p, lane_low(r0).data); _mm_storeu_ps(p + 12, lane_high(r0).data);
+		_mm_storeu_ps(p + 4, lane_low(r1).data); _mm_storeu_ps(p + 16, lane_high(r1).data);
+		_mm_storeu_ps(p + 8, lane_low(r2).data); _mm_storeu_ps(p + 20, lane_high(r2).data);
+	}
+
+	GLM_FUNC_QUALIFIER lanes8 lane_fma(lanes8 a, lanes8 b, lanes8 c)
+	{
+#		ifdef GLM_SIMD_FMA
+			return _mm256_fmadd_ps(a.data, b.data, c.data);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a.data, b.data), c.data);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER lanes8 lane_floor(lanes8 x) { return _mm256_floor_ps(x.data); }
+	GLM_FUNC_QUALIFIER lanes8 lane_abs(lanes8 x) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.data); }
+	GLM_FUNC_QUALIFIER lanes8 lane_sqrt(lanes8 x) { return _mm256_sqrt_ps(x.data); }
+	GLM_FUNC_QUALIFIER lanes8 lane_min(lanes8 a, lanes8 b) { return _mm256_min_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 lane_max(lanes8 a, lanes8 b) { return _mm256_max_ps(a.data, b.data); }
+
+	GLM_FUNC_QUALIFIER lanes8 lane_gt(lanes8 a, lanes8 b) { return _mm256_cmp_ps(a.data, b.data, _CMP_GT_OQ); }
+	GLM_FUNC_QUALIFIER lanes8 lane_ge(lanes8 a, lanes8 b) { return _mm256_cmp_ps(a.data, b.data, _CMP_GE_OQ); }
+	GLM_FUNC_QUALIFIER lanes8 lane_lt(lanes8 a, lanes8 b) { return _mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ); }
+	GLM_FUNC_QUALIFIER lanes8 lane_le(lanes8 a, lanes8 b) { return _mm256_cmp_ps(a.data, b.data, _CMP_LE_OQ); }
+	GLM_FUNC_QUALIFIER lanes8 lane_eq(lanes8 a, lanes8 b) { return _mm256_cmp_ps(a.data, b.data, _CMP_EQ_OQ); }
+	GLM_FUNC_QUALIFIER lanes8 lane_neq(lanes8 a, lanes8 b) { return _mm256_cmp_ps(a.data, b.data, _CMP_NEQ_UQ); }
+
+	GLM_FUNC_QUALIFIER lanes8 lane_and(lanes8 a, lanes8 b) { return _mm256_and_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 lane_or(lanes8 a, lanes8 b) { return _mm256_or_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 lane_andnot(lanes8 a, lanes8 b) { return _mm256_andnot_ps(a.data, b.data); }
+	GLM_FUNC_QUALIFIER lanes8 lane_select(lanes8 m, lanes8 t, lanes8 f)
+	{
+		// GCC rewrites blendv of a compare as a generic select, which it splits into scalar code without AVX2.
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return _mm256_blendv_ps(f.data, t.data, m.data);
+#		else
+			return _mm256_or_ps(_mm256_and_ps(m.data, t.data), _mm256_andnot_ps(m.data, f.data));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER lanes8 lane_xorsign(lanes8 x, lanes8 s) { return _mm256_xor_ps(x.data, _mm256_and_ps(s.data, _mm256_set1_ps(-0.0f))); }
+
+	// AVX has no 256-bit integer instructions; AVX2 does.
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	GLM_FUNC_QUALIFIER lanes8 lane_signbit(lanes8 x) { return _mm256_castsi256_ps(_mm256_srai_epi32(_mm256_castps_si256(x.data), 31)); }
+
+	GLM_FUNC_QUALIFIER lanes8 lane_pow2i(lanes8 n)
+	{
+		__m256i const e = _mm256_add_epi32(_mm256_cvttps_epi32(n.data), _mm256_set1_epi32(127));
+		return _mm256_castsi256_ps(_mm256_slli_epi32(e, 23));
+	}
+
+	GLM_FUNC_QUALIFIER lanes8 lane_frexp(lanes8 x, lanes8& e)
+	{
+		__m256i const i = _mm256_castps_si256(x.data);
+		e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(i, 23), _mm256_set1_epi32(126)));
+		__m256i const m = _mm256_and_si256(i, _mm256_set1_epi32(static_cast<int>(0x807fffffu)));
+		return _mm256_castsi256_ps(_mm256_or_si256(m, _mm256_set1_epi32(0x3f000000)));
+	}
+#	else
+	GLM_FUNC_QUALIFIER lanes8 lane_signbit(lanes8 x) { return lane_combine(lane_signbit(lane_low(x)), lane_signbit(lane_high(x))); }
+	GLM_FUNC_QUALIFIER lanes8 lane_pow2i(lanes8 n) { return lane_combine(lane_pow2i(lane_low(n)), lane_pow2i(lane_high(n))); }
+
+	GLM_FUNC_QUALIFIER lanes8 lane_frexp(lanes8 x, lanes8& e)
+	{
+		lanes4 elo, ehi;
+		lanes4 const lo = lane_frexp(lane_low(x), elo);
+		lanes4 const hi = lane_frexp(lane_high(x), ehi);
+		e = lane_combine(elo, ehi);
+		return lane_combine(lo, hi);
+	}
+#	endif
+
+	typedef lanes8 lanes;
+#	elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+	typedef lanes4 lanes;
+#	else
+	typedef float lanes;
+#	endif
+
+	std::size_t const lane_count = sizeof(lanes) / sizeof(float);
+
+	typedef lanes (*lanes_func1)(lanes const&);
+
+	// out[i] = Func(in[i]), lane_count values at a time. The tail runs on a zero padded copy.
+	GLM_FUNC_QUALIFIER void lanes_transform(lanes_func1 Func, float const* in, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i < count / lane_count * lane_count; i += lane_count)
+			lane_store(out + i, Func(lane_load<lanes>(in + i)));
+
+		if(i < count)
+		{
+			float tmp[lane_count] = {0};
+			std::memcpy(tmp, in + i, (count - i) * sizeof(float));
+			lane_store(tmp, Func(lane_load<lanes>(tmp)));
+			std::memcpy(out + i, tmp, (count - i) * sizeof(float));
+		}
+	}
+}//namespace detail
+}//namespace glm
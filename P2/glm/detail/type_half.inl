@@ -237,5 +237,36 @@ namespace detail
 		}
 	}
 
+
+	GLM_FUNC_QUALIFIER hdata toFloat16RoundEven(float value)
+	{
+		uif32 Entry(value);
+		unsigned int const s = Entry.i & 0x80000000u;
+		Entry.i ^= s;
+
+		unsigned int h;
+		if(Entry.i >= 0x47800000u)
+		{
+			// Overflow becomes infinity, NaNs keep their top 10 payload bits and are quieted.
+			h = Entry.i > 0x7f800000u ? 0x7e00u | ((Entry.i >> 13) & 0x3ffu) : 0x7c00u;
+		}
+		else if(Entry.i < 0x38800000u)
+		{
+			// Denormalized half or zero: adding 0.5f lines the half significand up with
+			// the float one, and the FPU does the round to nearest even.
+			uif32 Magic(0x3f000000u);
+			Entry.f += Magic.f;
+			h = Entry.i - Magic.i;
+		}
+		else
+		{
+			// Rebias the exponent and round: add 0.5 ulp - 1, plus 1 when the result would be odd.
+			unsigned int const odd = (Entry.i >> 13) & 1u;
+			h = (Entry.i + 0xc8000fffu + odd) >> 13;
+		}
+
+		return hdata(h | (s >> 16));
+	}
+
 }//namespace detail
 }//namespace glm
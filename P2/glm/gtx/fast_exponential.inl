@@ -1,5 +1,7 @@
 /// @ref gtx_fast_exponential
 
+#include "../detail/_lanes.hpp"
+
 namespace glm
 {
 	// fastPow:
@@ -133,4 +135,77 @@ namespace glm
 	{
 		return detail::functor1<vec, L, T, T, Q>::call(fastLog2, x);
 	}
+
+namespace detail
+{
+	// Array kernels, after the single precision Cephes expf/logf.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V exp_lanes(V const& x)
+	{
+		// NaN goes through the clamp; n is zeroed for it so the scale stays defined.
+		V const c = lane_max(V(-104.0f), lane_min(V(89.0f), x));
+		V n = lane_floor(lane_fma(c, V(1.44269504088896341f), V(0.5f)));
+		n = lane_select(lane_eq(n, n), n, V(0.0f));
+
+		V r = lane_fma(n, V(-0.693359375f), c);
+		r = lane_fma(n, V(2.12194440e-4f), r);
+		V const rr = r * r;
+
+		V p = lane_fma(V(1.9875691500e-4f), r, V(1.3981999507e-3f));
+		p = lane_fma(p, r, V(8.3334519073e-3f));
+		p = lane_fma(p, r, V(4.1665795894e-2f));
+		p = lane_fma(p, r, V(1.6666665459e-1f));
+		p = lane_fma(p, r, V(5.0000001201e-1f));
+		p = lane_fma(p, rr, r) + V(1.0f);
+
+		// 2^n as two factors so denormal results and overflow to inf both come out right.
+		V const n1 = lane_floor(n * V(0.5f));
+		return p * lane_pow2i(n1) * lane_pow2i(n - n1);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V log_lanes(V const& x)
+	{
+		typedef typename lane_mask<V>::type mask;
+
+		// Denormals are scaled into the normal range first.
+		mask const tiny = lane_lt(x, V(1.17549435e-38f));
+		V e;
+		V m = lane_frexp(lane_select(tiny, x * V(8388608.0f), x), e);
+		e = e - lane_select(tiny, V(23.0f), V(0.0f));
+
+		mask const low = lane_lt(m, V(0.707106781186547524f));
+		e = e - lane_select(low, V(1.0f), V(0.0f));
+		m = lane_select(low, m + m, m) - V(1.0f);
+		V const z = m * m;
+
+		V p = lane_fma(V(7.0376836292e-2f), m, V(-1.1514610310e-1f));
+		p = lane_fma(p, m, V(1.1676998740e-1f));
+		p = lane_fma(p, m, V(-1.2420140846e-1f));
+		p = lane_fma(p, m, V(1.4249322787e-1f));
+		p = lane_fma(p, m, V(-1.6668057665e-1f));
+		p = lane_fma(p, m, V(2.0000714765e-1f));
+		p = lane_fma(p, m, V(-2.4999993993e-1f));
+		p = lane_fma(p, m, V(3.3333331174e-1f));
+
+		V r = lane_fma(p * m, z, e * V(-2.12194440e-4f));
+		r = lane_fma(z, V(-0.5f), r) + m;
+		r = lane_fma(e, V(0.693359375f), r);
+
+		r = lane_select(lane_eq(x, V(std::numeric_limits<float>::infinity())), x, r);
+		r = lane_select(lane_eq(x, V(0.0f)), V(-std::numeric_limits<float>::infinity()), r);
+		r = lane_select(lane_lt(x, V(0.0f)), V(std::numeric_limits<float>::quiet_NaN()), r);
+		return lane_select(lane_neq(x, x), x, r);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void fastExpArray(float const* x, float* out, std::size_t count)
+	{
+		detail::lanes_transform(detail::exp_lanes<detail::lanes>, x, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastLogArray(float const* x, float* out, std::size_t count)
+	{
+		detail::lanes_transform(detail::log_lanes<detail::lanes>, x, out, count);
+	}
 }//namespace glm
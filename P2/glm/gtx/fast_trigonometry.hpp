@@ -14,6 +14,7 @@
 
 // Dependency:
 #include "../gtc/constants.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -73,6 +74,25 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL T fastAtan(T angle);
 
+	/// Writes sin(angles[i]) to out[i], several values per instruction on SSE2 and AVX.
+	/// Within 2.5 ULP of the correctly rounded result for |angle| <= 8192; accuracy
+	/// falls off beyond that. out may be the same array as angles.
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DECL void fastSinArray(float const* angles, float* out, std::size_t count);
+
+	/// Writes cos(angles[i]) to out[i], with the same accuracy as fastSinArray.
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DECL void fastCosArray(float const* angles, float* out, std::size_t count);
+
+	/// Writes both sin and cos of each angle, sharing the range reduction.
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DECL void fastSinCosArray(float const* angles, float* sines, float* cosines, std::size_t count);
+
+	/// Writes atan2(y[i], x[i]) to out[i], within 3.5 ULP over the whole plane, with
+	/// the signed zero, infinity and NaN results of std::atan2.
+	/// From GLM_GTX_fast_trigonometry extension.
+	GLM_FUNC_DECL void fastAtan2Array(float const* y, float const* x, float* out, std::size_t count);
+
 	/// @}
 }//namespace glm
 
@@ -364,3 +364,16 @@
 	typedef __m256i			glm_i64vec4;
 	typedef __m256i			glm_u64vec4;
 #endif
+
+// Every AVX2 CPU has FMA3, but GCC and Clang only accept the intrinsics with -mfma
+// (or an -march that implies it). Fused multiply-adds round once instead of twice,
+// so results of the FMA paths can differ from the SSE paths in the last bit.
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__FMA__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_SIMD_FMA 1
+#endif
+
+// F16C (half <-> float conversion) ships on every AVX2 CPU and most AVX ones.
+// GCC and Clang need -mf16c or an -march that implies it.
+#if (GLM_ARCH & GLM_ARCH_AVX_BIT) && (defined(__F16C__) || ((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2_BIT)))
+#	define GLM_SIMD_F16C 1
+#endif
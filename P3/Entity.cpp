@@ -8,7 +8,7 @@ Entity::Entity()
     velocity = glm::vec3(0);
     speed = 0;
     
-    modelMatrix = glm::mat4(1.0f);
+    modelMatrix = glm::mat3x2(1.0f);
 }
 
 bool Entity::CheckCollision(Entity *other){
@@ -73,8 +73,21 @@ void Entity::CheckCollisionsX(Entity *objects, int objectCount){
     }
 }
 
+void Entity::CountRest(){
+    bool still = fabs(velocity.x) < SLEEP_SPEED && fabs(velocity.y) < SLEEP_SPEED && acceleration.x == 0 && collidedBottom;
+    restSteps = (still || isDead || hasWon) ? restSteps + 1 : 0;
+    if (restSteps >= SLEEP_STEPS) isSleeping = true;
+}
+
+void Entity::Wake(){
+    isSleeping = false;
+    restSteps = 0;
+}
+
 void Entity::Update(float deltaTime, Entity *platforms, int platformCount, Entity *walls, int wallCount){
     
+    if(isSleeping) return;
+    
     if(entityType == EntityType::PLAYER){
         if(isActive == false) return;
         
@@ -121,10 +134,10 @@ void Entity::Update(float deltaTime, Entity *platforms, int platformCount, Entit
             CheckCollisionsX(walls, wallCount);// Fix if needed
         }
         
+        CountRest();
     }
     
-    modelMatrix = glm::mat4(1.0f);
-    modelMatrix = glm::translate(modelMatrix, position);
+    modelMatrix = glm::translate(glm::mat3x2(1.0f), glm::vec2(position));
 }
 
 void Entity::DrawSpriteFromTextureAtlas(ShaderProgram *program, GLuint textureID, int index)
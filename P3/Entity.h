@@ -9,10 +9,17 @@
 #include <SDL_opengl.h>
 #include "glm/mat4x4.hpp"
 #include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtx/matrix_transform_2d.hpp"
 #include "ShaderProgram.h"
 
 enum EntityType {PLAYER, PLATFORMS, WALLS};
 
+// The player goes to sleep after SLEEP_STEPS steps in a row slower than
+// SLEEP_SPEED with no thrust while standing on something, or once the game
+// is over. A sleeping entity skips Update until Wake.
+#define SLEEP_SPEED 0.01f
+#define SLEEP_STEPS 30
+
 class Entity {
 public:
     
@@ -33,7 +40,7 @@ public:
     
     GLuint textureID;
     
-    glm::mat4 modelMatrix;
+    glm::mat3x2 modelMatrix;
     
     int *animRight = NULL;
     int *animLeft = NULL;
@@ -51,6 +58,9 @@ public:
     bool isDead = false;
     bool hasWon = false;
     
+    bool isSleeping = false;
+    int restSteps = 0;
+    
     bool collidedTop = false;
     bool collidedBottom = false;
     bool collidedLeft = false;
@@ -62,6 +72,9 @@ public:
     void CheckCollisionsY(Entity *objects, int objectCount);
     void CheckCollisionsX(Entity *objects, int objectCount);
     
+    void CountRest();
+    void Wake();
+    
     void Update(float deltaTime, Entity *platforms, int platformCount, Entity *walls, int wallCount);
     void Render(ShaderProgram *program);
     void DrawSpriteFromTextureAtlas(ShaderProgram *program, GLuint textureID, int index);
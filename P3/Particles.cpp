@@ -0,0 +1,162 @@
+#include "Particles.h"
+
+#include <cmath>
+#include "glm/gtc/random.hpp"
+#include "glm/gtx/matrix_transform_2d.hpp"
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+#define PARTICLES_USE_SSE 1
+#endif
+
+void ParticleSystem::Init(int capacity, float lifetime){
+    Free();
+    this->capacity = capacity;
+    this->lifetime = lifetime;
+    x = new float[capacity];
+    y = new float[capacity];
+    vx = new float[capacity];
+    vy = new float[capacity];
+    age = new float[capacity];
+    alpha = new float[capacity];
+}
+
+void ParticleSystem::Free(){
+    delete[] x;
+    delete[] y;
+    delete[] vx;
+    delete[] vy;
+    delete[] age;
+    delete[] alpha;
+    x = y = vx = vy = age = alpha = NULL;
+    capacity = head = count = 0;
+    if (buffer != 0) glDeleteBuffers(1, &buffer);
+    buffer = 0;
+}
+
+void ParticleSystem::Clear(){
+    head = count = 0;
+}
+
+void ParticleSystem::Spawn(float x, float y, float vx, float vy){
+    this->x[head] = x;
+    this->y[head] = y;
+    this->vx[head] = vx;
+    this->vy[head] = vy;
+    age[head] = 0;
+    alpha[head] = 1;
+    head = (head + 1) % capacity;
+    if (count < capacity) count++;
+}
+
+void ParticleSystem::Emit(ParticleEmitter &emitter, glm::vec2 position, float deltaTime){
+    emitter.pending += emitter.rate * deltaTime;
+    int spawnCount = (int)emitter.pending;
+    emitter.pending -= spawnCount;
+
+    for (int i = 0; i < spawnCount; i++) {
+        float angle = emitter.angle + glm::linearRand(-emitter.angleSpread, emitter.angleSpread);
+        float speed = emitter.speed + glm::linearRand(-emitter.speedSpread, emitter.speedSpread);
+        Spawn(position.x, position.y, cosf(angle) * speed, sinf(angle) * speed);
+    }
+}
+
+void ParticleSystem::Burst(glm::vec2 position, int count, float speed){
+    for (int i = 0; i < count; i++) {
+        glm::vec2 velocity = glm::circularRand(1.0f) * glm::linearRand(0.25f * speed, speed);
+        Spawn(position.x, position.y, velocity.x, velocity.y);
+    }
+}
+
+void ParticleSystem::UpdateRange(int begin, int end, float deltaTime){
+    float gx = gravity.x * deltaTime;
+    float gy = gravity.y * deltaTime;
+    float fade = 1.0f / lifetime;
+
+    int i = begin;
+#ifdef PARTICLES_USE_SSE
+    __m128 dt = _mm_set1_ps(deltaTime);
+    __m128 dvx = _mm_set1_ps(gx), dvy = _mm_set1_ps(gy);
+    __m128 fadeRate = _mm_set1_ps(fade);
+    __m128 one = _mm_set1_ps(1.0f), zero = _mm_setzero_ps();
+
+    for (; i + 4 <= end; i += 4) {
+        __m128 velocityX = _mm_add_ps(_mm_loadu_ps(vx + i), dvx);
+        __m128 velocityY = _mm_add_ps(_mm_loadu_ps(vy + i), dvy);
+        __m128 a = _mm_add_ps(_mm_loadu_ps(age + i), dt);
+        _mm_storeu_ps(vx + i, velocityX);
+        _mm_storeu_ps(vy + i, velocityY);
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(velocityX, dt)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(velocityY, dt)));
+        _mm_storeu_ps(age + i, a);
+        _mm_storeu_ps(alpha + i, _mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(a, fadeRate)), zero));
+    }
+#endif
+    for (; i < end; i++) {
+        vx[i] += gx;
+        vy[i] += gy;
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+        age[i] += deltaTime;
+        alpha[i] = fmaxf(1.0f - age[i] * fade, 0.0f);
+    }
+}
+
+void ParticleSystem::Update(float deltaTime){
+    if (count == 0) return;
+
+    // The live range is [tail, tail + count), wrapping at most once.
+    int tail = Tail();
+    int first = tail + count < capacity ? tail + count : capacity;
+    UpdateRange(tail, first, deltaTime);
+    UpdateRange(0, count - (first - tail), deltaTime);
+
+    while (count > 0 && age[tail] >= lifetime) {
+        tail = (tail + 1) % capacity;
+        count--;
+    }
+}
+
+// Copies the live part of field to offset in the bound buffer, in order.
+void ParticleSystem::Upload(const float *field, int offset){
+    int tail = Tail();
+    int first = tail + count < capacity ? count : capacity - tail;
+    glBufferSubData(GL_ARRAY_BUFFER, offset, first * sizeof(float), field + tail);
+    if (first < count) glBufferSubData(GL_ARRAY_BUFFER, offset + first * sizeof(float), (count - first) * sizeof(float), field);
+}
+
+void ParticleSystem::Render(ShaderProgram *program){
+    if (count == 0) return;
+
+    float vertices[] = { -0.5, -0.5, 0.5, -0.5, 0.5, 0.5, -0.5, -0.5, 0.5, 0.5, -0.5, 0.5 };
+
+    program->SetModelMatrix(glm::scale(glm::mat3x2(1.0f), glm::vec2(size)));
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(program->positionAttribute, 2, GL_FLOAT, false, 0, vertices);
+    glEnableVertexAttribArray(program->positionAttribute);
+
+    // Orphan last frame's storage instead of waiting for the GPU to finish with it.
+    if (buffer == 0) glGenBuffers(1, &buffer);
+    int block = count * sizeof(float);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, 3 * block, NULL, GL_STREAM_DRAW);
+    Upload(x, 0);
+    Upload(y, block);
+    Upload(alpha, 2 * block);
+
+    GLuint attributes[3] = { program->instanceXAttribute, program->instanceYAttribute, program->instanceAlphaAttribute };
+    for (int i = 0; i < 3; i++) {
+        glVertexAttribPointer(attributes[i], 1, GL_FLOAT, false, 0, (const void *)(size_t)(i * block));
+        glEnableVertexAttribArray(attributes[i]);
+        glVertexAttribDivisor(attributes[i], 1);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+
+    for (int i = 0; i < 3; i++) {
+        glVertexAttribDivisor(attributes[i], 0);
+        glDisableVertexAttribArray(attributes[i]);
+    }
+    glDisableVertexAttribArray(program->positionAttribute);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "ShaderProgram.h"
+#include "glm/vec2.hpp"
+
+// Settings for a continuous stream of particles. rate is in particles per
+// second; angle is the direction they leave in, in radians.
+struct ParticleEmitter {
+    float rate = 200;
+    float speed = 2;
+    float speedSpread = 0.5f;
+    float angle = 0;
+    float angleSpread = 0.3f;
+
+    // Fraction of a particle left over from the last Emit.
+    float pending = 0;
+};
+
+// Fixed-capacity ring of particles in structure-of-arrays layout. Every
+// particle lives for the same time, so the order they are spawned in is the
+// order they die in: the live ones are always the count entries before head,
+// and expiring them only moves the tail. When the ring is full new
+// particles overwrite the oldest.
+//
+// Particles are only drawn, never read back by the simulation.
+class ParticleSystem {
+public:
+    float *x = NULL;
+    float *y = NULL;
+    float *vx = NULL;
+    float *vy = NULL;
+    float *age = NULL;
+    float *alpha = NULL;
+
+    int capacity = 0;
+    int head = 0;
+    int count = 0;
+
+    float lifetime = 0.5f;
+    glm::vec2 gravity = glm::vec2(0);
+    float size = 0.05f;
+
+    void Init(int capacity, float lifetime);
+    void Free();
+    void Clear();
+
+    void Spawn(float x, float y, float vx, float vy);
+
+    // Spawns emitter.rate * deltaTime particles at position.
+    void Emit(ParticleEmitter &emitter, glm::vec2 position, float deltaTime);
+
+    // Spawns count particles flying out in every direction.
+    void Burst(glm::vec2 position, int count, float speed);
+
+    // Moves and ages every live particle and fades it out over its lifetime.
+    void Update(float deltaTime);
+
+    // One instanced draw; program must use vertex_particle.glsl. The live
+    // particles are streamed into a buffer each call, so a ring that wraps
+    // still goes out contiguous.
+    void Render(ShaderProgram *program);
+
+private:
+    GLuint buffer = 0;
+
+    int Tail() const { return (head - count + capacity) % capacity; }
+    void UpdateRange(int begin, int end, float deltaTime);
+    void Upload(const float *field, int offset);
+};
@@ -28,6 +28,9 @@ void ShaderProgram::Load(const char *vertexShaderFile, const char *fragmentShade
     
     positionAttribute = glGetAttribLocation(programID, "position");
     texCoordAttribute = glGetAttribLocation(programID, "texCoord");
+    instanceXAttribute = glGetAttribLocation(programID, "instanceX");
+    instanceYAttribute = glGetAttribLocation(programID, "instanceY");
+    instanceAlphaAttribute = glGetAttribLocation(programID, "instanceAlpha");
 	
 	SetColor(1.0f, 1.0f, 1.0f, 1.0f);
     
@@ -94,9 +97,11 @@ void ShaderProgram::SetViewMatrix(const glm::mat4 &matrix) {
     glUniformMatrix4fv(viewMatrixUniform, 1, GL_FALSE, &matrix[0][0]);
 }
 
-void ShaderProgram::SetModelMatrix(const glm::mat4 &matrix) {
+// Sprites only move, scale and rotate in 2D, so the model matrix is the
+// 2D affine part alone: 6 floats instead of 16.
+void ShaderProgram::SetModelMatrix(const glm::mat3x2 &matrix) {
     glUseProgram(programID);
-    glUniformMatrix4fv(modelMatrixUniform, 1, GL_FALSE, &matrix[0][0]);
+    glUniformMatrix3x2fv(modelMatrixUniform, 1, GL_FALSE, &matrix[0][0]);
 }
 
 void ShaderProgram::SetProjectionMatrix(const glm::mat4 &matrix) {
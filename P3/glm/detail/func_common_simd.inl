@@ -195,7 +195,7 @@ namespace detail
 			__m128 const Mask = _mm_castsi128_ps(Load);
 
 			vec<4, float, Q> Result;
-#			if 0 && GLM_ARCH & GLM_ARCH_AVX
+#			if GLM_ARCH & GLM_ARCH_SSE41_BIT
 				Result.data = _mm_blendv_ps(x.data, y.data, Mask);
 #			else
 				Result.data = _mm_or_ps(_mm_and_ps(Mask, y.data), _mm_andnot_ps(Mask, x.data));
@@ -35,6 +35,20 @@ namespace detail
 		}
 	};
 
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_dot<vec<4, double, Q>, double, true>
+	{
+		GLM_FUNC_QUALIFIER static double call(vec<4, double, Q> const& x, vec<4, double, Q> const& y)
+		{
+			__m256d const mul0 = _mm256_mul_pd(x.data, y.data);
+			__m128d const add0 = _mm_add_pd(_mm256_castpd256_pd128(mul0), _mm256_extractf128_pd(mul0, 1));
+			__m128d const add1 = _mm_add_sd(add0, _mm_unpackhi_pd(add0, add0));
+			return _mm_cvtsd_f64(add1);
+		}
+	};
+#	endif
+
 	template<qualifier Q>
 	struct compute_cross<float, Q, true>
 	{
@@ -10,6 +10,9 @@ namespace detail
 	GLM_FUNC_DECL float toFloat32(hdata value);
 	GLM_FUNC_DECL hdata toFloat16(float const& value);
 
+	// IEEE round to nearest even, bit exact with F16C. toFloat16 rounds ties away from zero.
+	GLM_FUNC_DECL hdata toFloat16RoundEven(float value);
+
 }//namespace detail
 }//namespace glm
 
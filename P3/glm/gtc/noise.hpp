@@ -26,6 +26,7 @@
 #include "../vec2.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_noise extension included")
@@ -55,6 +56,37 @@ namespace glm
 	GLM_FUNC_DECL T simplex(
 		vec<L, T, Q> const& p);
 
+	/// Classic perlin noise at count points. xy holds x0, y0, x1, y1, ...
+	/// Points are evaluated four at a time, one per SIMD lane, and match
+	/// perlin(vec2) to within 1e-5 (bit exact when no FMA contraction happens).
+	/// @see gtc_noise
+	GLM_FUNC_DECL void perlinArray(
+		float const* xy, float* out, std::size_t count);
+
+	/// Simplex noise at count points. xy holds x0, y0, x1, y1, ...
+	/// Same lane layout and tolerance as perlinArray, compared with simplex(vec2).
+	/// @see gtc_noise
+	GLM_FUNC_DECL void simplexArray(
+		float const* xy, float* out, std::size_t count);
+
+	/// Fills a width x height row-major grid with fractal perlin noise.
+	/// Sample (x, y) of octave k is taken at (origin + vec2(x, y) * step) * lacunarity^k
+	/// and weighted by gain^k; the octaves are summed without normalization.
+	/// With C++11 and threads > 1, rows are split into bands evaluated on that many threads.
+	/// @see gtc_noise
+	GLM_FUNC_DECL void perlinGrid(
+		float* out, int width, int height,
+		vec<2, float, defaultp> const& origin, vec<2, float, defaultp> const& step,
+		int octaves = 1, float lacunarity = 2.0f, float gain = 0.5f, int threads = 1);
+
+	/// Fills a width x height row-major grid with fractal simplex noise.
+	/// Same parameters as perlinGrid.
+	/// @see gtc_noise
+	GLM_FUNC_DECL void simplexGrid(
+		float* out, int width, int height,
+		vec<2, float, defaultp> const& origin, vec<2, float, defaultp> const& step,
+		int octaves = 1, float lacunarity = 2.0f, float gain = 0.5f, int threads = 1);
+
 	/// @}
 }//namespace glm
 
@@ -1,5 +1,7 @@
 /// @ref gtx_fast_trigonometry
 
+#include "../detail/_lanes.hpp"
+
 namespace glm{
 namespace detail
 {
@@ -139,4 +141,143 @@ namespace detail
 	{
 		return detail::functor1<vec, L, T, T, Q>::call(fastAtan, x);
 	}
+
+namespace detail
+{
+	// Array kernels, after the single precision Cephes sinf/cosf/atan2f.
+	// The argument is reduced by pi/4 split in five parts; the first four have
+	// at most 11 significant bits so every y * part is exact for |x| <= 8192,
+	// which keeps the error relative even next to the zeros of sin and cos.
+	template<typename V>
+	GLM_FUNC_QUALIFIER void sincos_lanes(V const& x, V& s, V& c)
+	{
+		typedef typename lane_mask<V>::type mask;
+
+		V const ax = lane_abs(x);
+		V const q = lane_floor((lane_floor(ax * V(1.27323954473516f)) + V(1.0f)) * V(0.5f));
+		V const y = q + q;
+		V const q4 = q - V(4.0f) * lane_floor(q * V(0.25f));
+		V const c4 = (q + V(1.0f)) - V(4.0f) * lane_floor((q + V(1.0f)) * V(0.25f));
+		mask const odd = lane_neq(q - V(2.0f) * lane_floor(q * V(0.5f)), V(0.0f));
+
+		V z = lane_fma(y, V(-0.78515625f), ax);
+		z = lane_fma(y, V(-2.4187564849853515625e-4f), z);
+		z = lane_fma(y, V(-3.774766810238361358642578125e-8f), z);
+		z = lane_fma(y, V(-1.28164145962728071026504039764404296875e-12f), z);
+		z = lane_fma(y, V(-3.0616171314629196361e-17f), z);
+		V const zz = z * z;
+
+		V pc = lane_fma(V(2.443315711809948e-5f), zz, V(-1.388731625493765e-3f));
+		pc = lane_fma(pc, zz, V(4.166664568298827e-2f));
+		pc = lane_fma(pc * zz, zz, lane_fma(zz, V(-0.5f), V(1.0f)));
+
+		V ps = lane_fma(V(-1.9515295891e-4f), zz, V(8.3321608736e-3f));
+		ps = lane_fma(ps, zz, V(-1.6666654611e-1f));
+		ps = lane_fma(ps * zz, z, z);
+
+		s = lane_select(odd, pc, ps);
+		s = lane_xorsign(lane_select(lane_ge(q4, V(2.0f)), -s, s), x);
+		c = lane_select(odd, ps, pc);
+		c = lane_select(lane_ge(c4, V(2.0f)), -c, c);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V sin_lanes(V const& x)
+	{
+		V s, c;
+		sincos_lanes(x, s, c);
+		return s;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V cos_lanes(V const& x)
+	{
+		V s, c;
+		sincos_lanes(x, s, c);
+		return c;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V atan2_lanes(V const& y, V const& x)
+	{
+		typedef typename lane_mask<V>::type mask;
+
+		V const ax = lane_abs(x);
+		V const ay = lane_abs(y);
+		V const hi = lane_max(ax, ay);
+		V const lo = lane_min(ax, ay);
+
+		// 0/0 and inf/inf come out as the limits atan2 expects.
+		V a = lo / hi;
+		a = lane_select(lane_eq(hi, V(0.0f)), V(0.0f), a);
+		a = lane_select(lane_eq(lo, V(std::numeric_limits<float>::infinity())), V(1.0f), a);
+
+		mask const big = lane_gt(a, V(0.414213562373095f));
+		V const t = lane_select(big, (a - V(1.0f)) / (a + V(1.0f)), a);
+		V const z = t * t;
+
+		V r = lane_fma(V(8.05374449538e-2f), z, V(-1.38776856032e-1f));
+		r = lane_fma(r, z, V(1.99777106478e-1f));
+		r = lane_fma(r, z, V(-3.33329491539e-1f));
+		r = lane_fma(r * z, t, t) + lane_select(big, V(0.785398163397448f), V(0.0f));
+
+		r = lane_select(lane_gt(ay, ax), V(1.57079632679490f) - r, r);
+		r = lane_select(lane_signbit(x), V(3.14159265358979f) - r, r);
+		r = lane_xorsign(r, y);
+		return lane_select(lane_or(lane_neq(x, x), lane_neq(y, y)), x + y, r);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void fastSinArray(float const* angles, float* out, std::size_t count)
+	{
+		detail::lanes_transform(detail::sin_lanes<detail::lanes>, angles, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastCosArray(float const* angles, float* out, std::size_t count)
+	{
+		detail::lanes_transform(detail::cos_lanes<detail::lanes>, angles, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void fastSinCosArray(float const* angles, float* sines, float* cosines, std::size_t count)
+	{
+		std::size_t const N = detail::lane_count;
+		detail::lanes s, c;
+
+		std::size_t i = 0;
+		for(; i < count / N * N; i += N)
+		{
+			detail::sincos_lanes(detail::lane_load<detail::lanes>(angles + i), s, c);
+			detail::lane_store(sines + i, s);
+			detail::lane_store(cosines + i, c);
+		}
+
+		if(i < count)
+		{
+			float a[N] = {0}, r[N];
+			std::memcpy(a, angles + i, (count - i) * sizeof(float));
+			detail::sincos_lanes(detail::lane_load<detail::lanes>(a), s, c);
+			detail::lane_store(r, s);
+			std::memcpy(sines + i, r, (count - i) * sizeof(float));
+			detail::lane_store(r, c);
+			std::memcpy(cosines + i, r, (count - i) * sizeof(float));
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void fastAtan2Array(float const* y, float const* x, float* out, std::size_t count)
+	{
+		std::size_t const N = detail::lane_count;
+
+		std::size_t i = 0;
+		for(; i < count / N * N; i += N)
+			detail::lane_store(out + i, detail::atan2_lanes(detail::lane_load<detail::lanes>(y + i), detail::lane_load<detail::lanes>(x + i)));
+
+		if(i < count)
+		{
+			float a[N] = {0}, b[N] = {0};
+			std::memcpy(a, y + i, (count - i) * sizeof(float));
+			std::memcpy(b, x + i, (count - i) * sizeof(float));
+			detail::lane_store(a, detail::atan2_lanes(detail::lane_load<detail::lanes>(a), detail::lane_load<detail::lanes>(b)));
+			std::memcpy(out + i, a, (count - i) * sizeof(float));
+		}
+	}
 }//namespace glm
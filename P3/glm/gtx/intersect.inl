@@ -194,4 +194,237 @@ namespace glm
 		intersectionNormal2 = (intersectionPoint2 - sphereCenter) / sphereRadius;
 		return true;
 	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayAABB
+	(
+		vec<L, T, Q> const& orig, vec<L, T, Q> const& dir,
+		vec<L, T, Q> const& boxMin, vec<L, T, Q> const& boxMax,
+		T & distance
+	)
+	{
+		T tmin = static_cast<T>(0);
+		T tmax = std::numeric_limits<T>::max();
+		for(length_t i = 0; i < L; ++i)
+		{
+			T const inv = static_cast<T>(1) / dir[i];
+			T const t1 = (boxMin[i] - orig[i]) * inv;
+			T const t2 = (boxMax[i] - orig[i]) * inv;
+
+			// A NaN means dir is zero and orig lies on boxMin or boxMax, so the ray
+			// runs in a face plane, which counts as inside: the slab is skipped.
+			// Selects rather than a branch, so loops over boxes still vectorize.
+			bool const flat = (t1 != t1) | (t2 != t2);
+			T const lo = t1 < t2 ? t1 : t2;
+			T const hi = t1 > t2 ? t1 : t2;
+			T const nearer = lo > tmin ? lo : tmin;
+			T const farther = hi < tmax ? hi : tmax;
+			tmin = flat ? tmin : nearer;
+			tmax = flat ? tmax : farther;
+		}
+
+		distance = tmin;
+		return tmin <= tmax;
+	}
+
+namespace detail
+{
+	// One slab of the batch tests. A NaN t means a zero dir with orig on
+	// bmin or bmax: the ray runs in a face plane, which counts as inside, so
+	// the slab leaves the interval untouched whichever face it is.
+	GLM_FUNC_QUALIFIER void intersect_slab(float bmin, float bmax, float orig, float inv, float& tmin, float& tmax)
+	{
+		float const t1 = (bmin - orig) * inv;
+		float const t2 = (bmax - orig) * inv;
+		bool const flat = (t1 != t1) | (t2 != t2);
+		float const lo = t1 < t2 ? t1 : t2;
+		float const hi = t1 > t2 ? t1 : t2;
+		float const nearer = lo > tmin ? lo : tmin;
+		float const farther = hi < tmax ? hi : tmax;
+		tmin = flat ? tmin : nearer;
+		tmax = flat ? tmax : farther;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER void intersect_slab(__m128 bmin, __m128 bmax, __m128 orig, __m128 inv, __m128& tmin, __m128& tmax)
+	{
+		__m128 const t1 = _mm_mul_ps(_mm_sub_ps(bmin, orig), inv);
+		__m128 const t2 = _mm_mul_ps(_mm_sub_ps(bmax, orig), inv);
+		// NaN lanes make lo and hi all ones, a NaN, and _mm_max_ps and
+		// _mm_min_ps then return their second operand, the old bound.
+		__m128 const flat = _mm_cmpunord_ps(t1, t2);
+		tmin = _mm_max_ps(_mm_or_ps(_mm_min_ps(t1, t2), flat), tmin);
+		tmax = _mm_min_ps(_mm_or_ps(_mm_max_ps(t1, t2), flat), tmax);
+	}
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER void intersect_slab(__m256 bmin, __m256 bmax, __m256 orig, __m256 inv, __m256& tmin, __m256& tmax)
+	{
+		__m256 const t1 = _mm256_mul_ps(_mm256_sub_ps(bmin, orig), inv);
+		__m256 const t2 = _mm256_mul_ps(_mm256_sub_ps(bmax, orig), inv);
+		__m256 const flat = _mm256_cmp_ps(t1, t2, _CMP_UNORD_Q);
+		tmin = _mm256_max_ps(_mm256_or_ps(_mm256_min_ps(t1, t2), flat), tmin);
+		tmax = _mm256_min_ps(_mm256_or_ps(_mm256_max_ps(t1, t2), flat), tmax);
+	}
+#	endif
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER std::size_t intersectRayAABBArray
+	(
+		vec<3, float, defaultp> const& orig, vec<3, float, defaultp> const& dir, float maxDistance,
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ,
+		std::size_t count, uint32* hitMask, float* distances
+	)
+	{
+		bool const is3D = minZ != NULL && maxZ != NULL;
+		vec<3, float, defaultp> const inv = 1.0f / dir;
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			__m256 const ox8 = _mm256_set1_ps(orig.x), oy8 = _mm256_set1_ps(orig.y), oz8 = _mm256_set1_ps(orig.z);
+			__m256 const ix8 = _mm256_set1_ps(inv.x), iy8 = _mm256_set1_ps(inv.y), iz8 = _mm256_set1_ps(inv.z);
+#		endif
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128 const ox4 = _mm_set1_ps(orig.x), oy4 = _mm_set1_ps(orig.y), oz4 = _mm_set1_ps(orig.z);
+			__m128 const ix4 = _mm_set1_ps(inv.x), iy4 = _mm_set1_ps(inv.y), iz4 = _mm_set1_ps(inv.z);
+#		endif
+
+		std::size_t hits = 0;
+
+		// One mask word per 32 boxes, built in a register.
+		for(std::size_t base = 0; base < count; base += 32)
+		{
+			std::size_t const end = base + 32 < count ? base + 32 : count;
+			std::size_t i = base;
+			uint32 bits = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			for(; i + 8 <= end; i += 8)
+			{
+				__m256 tmin = _mm256_setzero_ps();
+				__m256 tmax = _mm256_set1_ps(maxDistance);
+				detail::intersect_slab(_mm256_loadu_ps(minX + i), _mm256_loadu_ps(maxX + i), ox8, ix8, tmin, tmax);
+				detail::intersect_slab(_mm256_loadu_ps(minY + i), _mm256_loadu_ps(maxY + i), oy8, iy8, tmin, tmax);
+				if(is3D)
+					detail::intersect_slab(_mm256_loadu_ps(minZ + i), _mm256_loadu_ps(maxZ + i), oz8, iz8, tmin, tmax);
+
+				bits |= static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(tmin, tmax, _CMP_LE_OQ))) << (i - base);
+				if(distances != NULL)
+					_mm256_storeu_ps(distances + i, tmin);
+			}
+#			endif
+
+#			if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i + 4 <= end; i += 4)
+			{
+				__m128 tmin = _mm_setzero_ps();
+				__m128 tmax = _mm_set1_ps(maxDistance);
+				detail::intersect_slab(_mm_loadu_ps(minX + i), _mm_loadu_ps(maxX + i), ox4, ix4, tmin, tmax);
+				detail::intersect_slab(_mm_loadu_ps(minY + i), _mm_loadu_ps(maxY + i), oy4, iy4, tmin, tmax);
+				if(is3D)
+					detail::intersect_slab(_mm_loadu_ps(minZ + i), _mm_loadu_ps(maxZ + i), oz4, iz4, tmin, tmax);
+
+				bits |= static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(tmin, tmax))) << (i - base);
+				if(distances != NULL)
+					_mm_storeu_ps(distances + i, tmin);
+			}
+#			endif
+
+			for(; i < end; ++i)
+			{
+				float tmin = 0.0f;
+				float tmax = maxDistance;
+				detail::intersect_slab(minX[i], maxX[i], orig.x, inv.x, tmin, tmax);
+				detail::intersect_slab(minY[i], maxY[i], orig.y, inv.y, tmin, tmax);
+				if(is3D)
+					detail::intersect_slab(minZ[i], maxZ[i], orig.z, inv.z, tmin, tmax);
+
+				bits |= static_cast<uint32>(tmin <= tmax) << (i - base);
+				if(distances != NULL)
+					distances[i] = tmin;
+			}
+
+			hitMask[base / 32] = bits;
+			hits += static_cast<std::size_t>(bitCount(bits));
+		}
+
+		return hits;
+	}
+
+	GLM_FUNC_QUALIFIER uint32 intersectRayPacketAABB
+	(
+		float const* origX, float const* origY, float const* origZ,
+		float const* dirX, float const* dirY, float const* dirZ,
+		std::size_t count, float maxDistance,
+		vec<3, float, defaultp> const& boxMin, vec<3, float, defaultp> const& boxMax,
+		float* distances
+	)
+	{
+		assert(count <= 32);
+
+		bool const is3D = origZ != NULL && dirZ != NULL;
+		int const n = static_cast<int>(count);
+		uint32 mask = 0;
+		int i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		{
+			__m256 const one = _mm256_set1_ps(1.0f);
+			__m256 const bminX = _mm256_set1_ps(boxMin.x), bminY = _mm256_set1_ps(boxMin.y), bminZ = _mm256_set1_ps(boxMin.z);
+			__m256 const bmaxX = _mm256_set1_ps(boxMax.x), bmaxY = _mm256_set1_ps(boxMax.y), bmaxZ = _mm256_set1_ps(boxMax.z);
+			for(; i + 8 <= n; i += 8)
+			{
+				__m256 tmin = _mm256_setzero_ps();
+				__m256 tmax = _mm256_set1_ps(maxDistance);
+				detail::intersect_slab(bminX, bmaxX, _mm256_loadu_ps(origX + i), _mm256_div_ps(one, _mm256_loadu_ps(dirX + i)), tmin, tmax);
+				detail::intersect_slab(bminY, bmaxY, _mm256_loadu_ps(origY + i), _mm256_div_ps(one, _mm256_loadu_ps(dirY + i)), tmin, tmax);
+				if(is3D)
+					detail::intersect_slab(bminZ, bmaxZ, _mm256_loadu_ps(origZ + i), _mm256_div_ps(one, _mm256_loadu_ps(dirZ + i)), tmin, tmax);
+
+				mask |= static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(tmin, tmax, _CMP_LE_OQ))) << i;
+				if(distances != NULL)
+					_mm256_storeu_ps(distances + i, tmin);
+			}
+		}
+#		endif
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+		{
+			__m128 const one = _mm_set1_ps(1.0f);
+			__m128 const bminX = _mm_set1_ps(boxMin.x), bminY = _mm_set1_ps(boxMin.y), bminZ = _mm_set1_ps(boxMin.z);
+			__m128 const bmaxX = _mm_set1_ps(boxMax.x), bmaxY = _mm_set1_ps(boxMax.y), bmaxZ = _mm_set1_ps(boxMax.z);
+			for(; i + 4 <= n; i += 4)
+			{
+				__m128 tmin = _mm_setzero_ps();
+				__m128 tmax = _mm_set1_ps(maxDistance);
+				detail::intersect_slab(bminX, bmaxX, _mm_loadu_ps(origX + i), _mm_div_ps(one, _mm_loadu_ps(dirX + i)), tmin, tmax);
+				detail::intersect_slab(bminY, bmaxY, _mm_loadu_ps(origY + i), _mm_div_ps(one, _mm_loadu_ps(dirY + i)), tmin, tmax);
+				if(is3D)
+					detail::intersect_slab(bminZ, bmaxZ, _mm_loadu_ps(origZ + i), _mm_div_ps(one, _mm_loadu_ps(dirZ + i)), tmin, tmax);
+
+				mask |= static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(tmin, tmax))) << i;
+				if(distances != NULL)
+					_mm_storeu_ps(distances + i, tmin);
+			}
+		}
+#		endif
+
+		for(; i < n; ++i)
+		{
+			float tmin = 0.0f;
+			float tmax = maxDistance;
+			detail::intersect_slab(boxMin.x, boxMax.x, origX[i], 1.0f / dirX[i], tmin, tmax);
+			detail::intersect_slab(boxMin.y, boxMax.y, origY[i], 1.0f / dirY[i], tmin, tmax);
+			if(is3D)
+				detail::intersect_slab(boxMin.z, boxMax.z, origZ[i], 1.0f / dirZ[i], tmin, tmax);
+
+			if(tmin <= tmax)
+				mask |= 1u << i;
+			if(distances != NULL)
+				distances[i] = tmin;
+		}
+
+		return mask;
+	}
 }//namespace glm
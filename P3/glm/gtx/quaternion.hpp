@@ -3,6 +3,7 @@
 ///
 /// @see core (dependence)
 /// @see gtx_extented_min_max (dependence)
+/// @see gtx_fast_trigonometry (dependence)
 ///
 /// @defgroup gtx_quaternion GLM_GTX_quaternion
 /// @ingroup gtx
@@ -19,6 +20,8 @@
 #include "../gtc/quaternion.hpp"
 #include "../ext/quaternion_exponential.hpp"
 #include "../gtx/norm.hpp"
+#include "../gtx/fast_trigonometry.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -168,6 +171,43 @@ namespace glm
 	template<typename T, qualifier Q>
 	GLM_FUNC_DECL T length2(qua<T, Q> const& q);
 
+	/// Writes slerp(x[i], y[i], a[i]) to out[i], several quaternions per instruction
+	/// on SSE2 and AVX. Matches the scalar slerp to a few float ULP, including the
+	/// short path flip and the linear fallback for nearly equal inputs.
+	/// out may be the same array as x or y.
+	///
+	/// @see gtx_quaternion
+	template<qualifier Q>
+	GLM_FUNC_DECL void slerpArray(
+		qua<float, Q> const* x,
+		qua<float, Q> const* y,
+		float const* a,
+		qua<float, Q>* out,
+		std::size_t count);
+
+	/// Writes normalize(mix(x[i], y[i], a[i])) to out[i], with y[i] negated when
+	/// that gives the shorter path. Cheaper than slerpArray and close to it for
+	/// the small steps between animation keys.
+	///
+	/// @see gtx_quaternion
+	template<qualifier Q>
+	GLM_FUNC_DECL void nlerpArray(
+		qua<float, Q> const* x,
+		qua<float, Q> const* y,
+		float const* a,
+		qua<float, Q>* out,
+		std::size_t count);
+
+	/// Writes rotate(q[i], v[i]) to out[i]. out may be the same array as v.
+	///
+	/// @see gtx_quaternion
+	template<qualifier Q>
+	GLM_FUNC_DECL void rotateArray(
+		qua<float, Q> const* q,
+		vec<3, float, Q> const* v,
+		vec<3, float, Q>* out,
+		std::size_t count);
+
 	/// @}
 }//namespace glm
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "geometric.h"
+#include <cstddef>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -38,14 +39,22 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_mat4_mul_vec4(glm_vec4 const m[4], glm_vec4 v)
 	__m128 v2 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
 	__m128 v3 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
 
-	__m128 m0 = _mm_mul_ps(m[0], v0);
-	__m128 m1 = _mm_mul_ps(m[1], v1);
-	__m128 m2 = _mm_mul_ps(m[2], v2);
-	__m128 m3 = _mm_mul_ps(m[3], v3);
+#	ifdef GLM_SIMD_FMA
+		__m128 m0 = _mm_mul_ps(m[0], v0);
+		__m128 m1 = _mm_mul_ps(m[2], v2);
+		__m128 a0 = _mm_fmadd_ps(m[1], v1, m0);
+		__m128 a1 = _mm_fmadd_ps(m[3], v3, m1);
+		__m128 a2 = _mm_add_ps(a0, a1);
+#	else
+		__m128 m0 = _mm_mul_ps(m[0], v0);
+		__m128 m1 = _mm_mul_ps(m[1], v1);
+		__m128 m2 = _mm_mul_ps(m[2], v2);
+		__m128 m3 = _mm_mul_ps(m[3], v3);
 
-	__m128 a0 = _mm_add_ps(m0, m1);
-	__m128 a1 = _mm_add_ps(m2, m3);
-	__m128 a2 = _mm_add_ps(a0, a1);
+		__m128 a0 = _mm_add_ps(m0, m1);
+		__m128 a1 = _mm_add_ps(m2, m3);
+		__m128 a2 = _mm_add_ps(a0, a1);
+#	endif
 
 	return a2;
 }
@@ -85,14 +94,22 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e2 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(2, 2, 2, 2));
 		__m128 e3 = _mm_shuffle_ps(in2[0], in2[0], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
+#		ifdef GLM_SIMD_FMA
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[2], e2);
+			__m128 a0 = _mm_fmadd_ps(in1[1], e1, m0);
+			__m128 a1 = _mm_fmadd_ps(in1[3], e3, m1);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		else
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[1], e1);
+			__m128 m2 = _mm_mul_ps(in1[2], e2);
+			__m128 m3 = _mm_mul_ps(in1[3], e3);
+
+			__m128 a0 = _mm_add_ps(m0, m1);
+			__m128 a1 = _mm_add_ps(m2, m3);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		endif
 
 		out[0] = a2;
 	}
@@ -103,14 +120,22 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e2 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(2, 2, 2, 2));
 		__m128 e3 = _mm_shuffle_ps(in2[1], in2[1], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
+#		ifdef GLM_SIMD_FMA
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[2], e2);
+			__m128 a0 = _mm_fmadd_ps(in1[1], e1, m0);
+			__m128 a1 = _mm_fmadd_ps(in1[3], e3, m1);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		else
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[1], e1);
+			__m128 m2 = _mm_mul_ps(in1[2], e2);
+			__m128 m3 = _mm_mul_ps(in1[3], e3);
+
+			__m128 a0 = _mm_add_ps(m0, m1);
+			__m128 a1 = _mm_add_ps(m2, m3);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		endif
 
 		out[1] = a2;
 	}
@@ -121,14 +146,22 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e2 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(2, 2, 2, 2));
 		__m128 e3 = _mm_shuffle_ps(in2[2], in2[2], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
+#		ifdef GLM_SIMD_FMA
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[2], e2);
+			__m128 a0 = _mm_fmadd_ps(in1[1], e1, m0);
+			__m128 a1 = _mm_fmadd_ps(in1[3], e3, m1);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		else
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[1], e1);
+			__m128 m2 = _mm_mul_ps(in1[2], e2);
+			__m128 m3 = _mm_mul_ps(in1[3], e3);
+
+			__m128 a0 = _mm_add_ps(m0, m1);
+			__m128 a1 = _mm_add_ps(m2, m3);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		endif
 
 		out[2] = a2;
 	}
@@ -140,14 +173,22 @@ GLM_FUNC_QUALIFIER void glm_mat4_mul(glm_vec4 const in1[4], glm_vec4 const in2[4
 		__m128 e2 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(2, 2, 2, 2));
 		__m128 e3 = _mm_shuffle_ps(in2[3], in2[3], _MM_SHUFFLE(3, 3, 3, 3));
 
-		__m128 m0 = _mm_mul_ps(in1[0], e0);
-		__m128 m1 = _mm_mul_ps(in1[1], e1);
-		__m128 m2 = _mm_mul_ps(in1[2], e2);
-		__m128 m3 = _mm_mul_ps(in1[3], e3);
-
-		__m128 a0 = _mm_add_ps(m0, m1);
-		__m128 a1 = _mm_add_ps(m2, m3);
-		__m128 a2 = _mm_add_ps(a0, a1);
+#		ifdef GLM_SIMD_FMA
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[2], e2);
+			__m128 a0 = _mm_fmadd_ps(in1[1], e1, m0);
+			__m128 a1 = _mm_fmadd_ps(in1[3], e3, m1);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		else
+			__m128 m0 = _mm_mul_ps(in1[0], e0);
+			__m128 m1 = _mm_mul_ps(in1[1], e1);
+			__m128 m2 = _mm_mul_ps(in1[2], e2);
+			__m128 m3 = _mm_mul_ps(in1[3], e3);
+
+			__m128 a0 = _mm_add_ps(m0, m1);
+			__m128 a1 = _mm_add_ps(m2, m3);
+			__m128 a2 = _mm_add_ps(a0, a1);
+#		endif
 
 		out[3] = a2;
 	}
@@ -1026,3 +1067,202 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+// Double precision columns fill a whole 256-bit register, so dmat4 gets the
+// same broadcast-and-accumulate kernels as mat4, just twice as wide.
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dvec4_fma(glm_dvec4 a, glm_dvec4 b, glm_dvec4 c)
+{
+#	ifdef GLM_SIMD_FMA
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	glm_dvec4 const lo = _mm256_permute2f128_pd(v, v, 0x00);
+	glm_dvec4 const hi = _mm256_permute2f128_pd(v, v, 0x11);
+
+	glm_dvec4 const v0 = _mm256_permute_pd(lo, 0x0);
+	glm_dvec4 const v1 = _mm256_permute_pd(lo, 0xF);
+	glm_dvec4 const v2 = _mm256_permute_pd(hi, 0x0);
+	glm_dvec4 const v3 = _mm256_permute_pd(hi, 0xF);
+
+	glm_dvec4 const a0 = glm_dvec4_fma(m[1], v1, _mm256_mul_pd(m[0], v0));
+	glm_dvec4 const a1 = glm_dvec4_fma(m[3], v3, _mm256_mul_pd(m[2], v2));
+	return _mm256_add_pd(a0, a1);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	glm_dvec4 Result[4];
+	for(int i = 0; i < 4; ++i)
+		Result[i] = glm_dmat4_mul_dvec4(in1, in2[i]);
+	for(int i = 0; i < 4; ++i)
+		out[i] = Result[i];
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Batch transforms. Matrices are column major (16 floats, same layout as
+// glm::mat4) and vectors are tightly packed float arrays, so these work on
+// &glm::vec4/vec3/vec2 arrays directly. The AVX2 path uses FMA when
+// GLM_SIMD_FMA is set, the SSE2 path uses mul/add pairs, and the scalar loop
+// handles any other target and the tail of each batch.
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+GLM_FUNC_QUALIFIER __m256 glm_vec8_fma(__m256 a, __m256 b, __m256 c)
+{
+#	ifdef GLM_SIMD_FMA
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+/// out[i] = m * in[i] for count vec4s. in and out may be the same array.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_array(float const m[16], float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	{
+		// Two vec4s per register; each 128 bit lane sees the full matrix.
+		__m256 const c0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 0));
+		__m256 const c1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 4));
+		__m256 const c2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 8));
+		__m256 const c3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 12));
+
+		for(; i + 2 <= count; i += 2)
+		{
+			__m256 const v = _mm256_loadu_ps(in + i * 4);
+			__m256 r = _mm256_mul_ps(c0, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = glm_vec8_fma(c1, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = glm_vec8_fma(c2, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = glm_vec8_fma(c3, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm256_storeu_ps(out + i * 4, r);
+		}
+	}
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	{
+		__m128 const c0 = _mm_loadu_ps(m + 0);
+		__m128 const c1 = _mm_loadu_ps(m + 4);
+		__m128 const c2 = _mm_loadu_ps(m + 8);
+		__m128 const c3 = _mm_loadu_ps(m + 12);
+
+		for(; i < count; ++i)
+		{
+			__m128 const v = _mm_loadu_ps(in + i * 4);
+			__m128 r = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = glm_vec4_fma(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+			r = glm_vec4_fma(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+			r = glm_vec4_fma(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+			_mm_storeu_ps(out + i * 4, r);
+		}
+	}
+#	endif
+
+	for(; i < count; ++i)
+	{
+		float const x = in[i * 4 + 0], y = in[i * 4 + 1], z = in[i * 4 + 2], w = in[i * 4 + 3];
+		for(int r = 0; r < 4; ++r)
+			out[i * 4 + r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+	}
+}
+
+/// out[i] = (m * vec4(in[i], 1)).xyz for count vec3 points. No perspective divide.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_point3_array(float const m[16], float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	{
+		__m128 const c0 = _mm_loadu_ps(m + 0);
+		__m128 const c1 = _mm_loadu_ps(m + 4);
+		__m128 const c2 = _mm_loadu_ps(m + 8);
+		__m128 const c3 = _mm_loadu_ps(m + 12);
+
+		// The 4th lane of each store spills into the next point, which is
+		// overwritten right after, so only the last point uses the scalar loop.
+		for(; i + 1 < count; ++i)
+		{
+			float const* p = in + i * 3;
+			__m128 r = _mm_mul_ps(c0, _mm_set1_ps(p[0]));
+			r = glm_vec4_fma(c1, _mm_set1_ps(p[1]), r);
+			r = glm_vec4_fma(c2, _mm_set1_ps(p[2]), r);
+			r = _mm_add_ps(r, c3);
+			if(in == out)
+			{
+				_mm_storel_pi(reinterpret_cast<__m64*>(out + i * 3), r);
+				_mm_store_ss(out + i * 3 + 2, _mm_movehl_ps(r, r));
+			}
+			else
+				_mm_storeu_ps(out + i * 3, r);
+		}
+	}
+#	endif
+
+	for(; i < count; ++i)
+	{
+		float const x = in[i * 3 + 0], y = in[i * 3 + 1], z = in[i * 3 + 2];
+		for(int r = 0; r < 3; ++r)
+			out[i * 3 + r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r];
+	}
+}
+
+/// out[i] = (m * vec4(in[i], 0, 1)).xy for count vec2 points. No perspective divide.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_point2_array(float const m[16], float const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	{
+		// Four points per register, as x0 y0 x1 y1 | x2 y2 x3 y3.
+		__m256 const cx = _mm256_setr_ps(m[0], m[1], m[0], m[1], m[0], m[1], m[0], m[1]);
+		__m256 const cy = _mm256_setr_ps(m[4], m[5], m[4], m[5], m[4], m[5], m[4], m[5]);
+		__m256 const ct = _mm256_setr_ps(m[12], m[13], m[12], m[13], m[12], m[13], m[12], m[13]);
+
+		for(; i + 4 <= count; i += 4)
+		{
+			__m256 const v = _mm256_loadu_ps(in + i * 2);
+			__m256 const x = _mm256_moveldup_ps(v);
+			__m256 const y = _mm256_movehdup_ps(v);
+			_mm256_storeu_ps(out + i * 2, _mm256_add_ps(glm_vec8_fma(cy, y, _mm256_mul_ps(cx, x)), ct));
+		}
+	}
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	{
+		__m128 const cx = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+		__m128 const cy = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+		__m128 const ct = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+
+		for(; i + 2 <= count; i += 2)
+		{
+			__m128 const v = _mm_loadu_ps(in + i * 2);
+			__m128 const x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+			__m128 const y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+			_mm_storeu_ps(out + i * 2, _mm_add_ps(glm_vec4_fma(cy, y, _mm_mul_ps(cx, x)), ct));
+		}
+	}
+#	endif
+
+	for(; i < count; ++i)
+	{
+		float const x = in[i * 2 + 0], y = in[i * 2 + 1];
+		out[i * 2 + 0] = m[0] * x + m[4] * y + m[12];
+		out[i * 2 + 1] = m[1] * x + m[5] * y + m[13];
+	}
+}
+
+/// out[i] = m * in[i] for count mat4s, e.g. parent * local transforms.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_mat4_array(float const m[16], float const* in, float* out, std::size_t count)
+{
+	// Each column of in[i] is transformed independently.
+	glm_mat4_mul_vec4_array(m, in, out, count * 4);
+}
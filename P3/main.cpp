@@ -17,6 +17,7 @@
 #include "stb_image.h"
 
 #include "Entity.h"
+#include "Particles.h"
 
 #define PLATFORM_COUNT 5
 #define WALL_COUNT 26
@@ -33,10 +34,15 @@ SDL_Window* displayWindow;
 bool gameIsRunning = true;
 
 ShaderProgram program;
+ShaderProgram particleProgram;
 glm::mat4 viewMatrix, modelMatrix, projectionMatrix;
 
 GLuint fontTextureID;
 
+// Exhaust from the side thrusters.
+ParticleSystem exhaust;
+ParticleEmitter thruster;
+
 GLuint LoadTexture(const char* filePath) {
     int w, h, n;
     unsigned char* image = stbi_load(filePath, &w, &h, &n, STBI_rgb_alpha);
@@ -92,8 +98,7 @@ void DrawText(ShaderProgram *program, GLuint fontTextureID, std::string text, fl
         
     } // end of for loop
     
-    glm::mat4 modelMatrix = glm::mat4(1.0f);
-    modelMatrix = glm::translate(modelMatrix, position);
+    glm::mat3x2 modelMatrix = glm::translate(glm::mat3x2(1.0f), glm::vec2(position));
     program->SetModelMatrix(modelMatrix);
     
     glUseProgram(program->programID);
@@ -132,6 +137,16 @@ void Initialize() {
     program.SetProjectionMatrix(projectionMatrix);
     program.SetViewMatrix(viewMatrix);
     
+    particleProgram.Load("shaders/vertex_particle.glsl", "shaders/fragment_particle.glsl");
+    particleProgram.SetProjectionMatrix(projectionMatrix);
+    particleProgram.SetViewMatrix(viewMatrix);
+    particleProgram.SetColor(1.0f, 0.6f, 0.1f, 1.0f);
+    
+    exhaust.Init(1024, 0.6f);
+    exhaust.gravity = glm::vec2(0, -0.5f);
+    thruster.rate = 300;
+    thruster.speed = 2;
+    
     glUseProgram(program.programID);
     
     glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
@@ -189,6 +204,7 @@ void Initialize() {
     for (int i = 0; i < PLATFORM_COUNT; i++){
         state.platforms[i].Update(0, NULL, 0, NULL, 0);
         state.platforms[i].entityType = EntityType::PLATFORMS;
+        state.platforms[i].isSleeping = true;
     }
     
     state.walls = new Entity[WALL_COUNT];
@@ -275,6 +291,7 @@ void Initialize() {
     for (int i = 0; i < WALL_COUNT; i++){
         state.walls[i].Update(0, NULL, 0, NULL, 0);
         state.walls[i].entityType = EntityType::WALLS;
+        state.walls[i].isSleeping = true;
     }
     
     fontTextureID = LoadTexture("font1.png");
@@ -331,6 +348,8 @@ void ProcessInput() {
     if (glm::length(state.player->movement) > 1.0f) {
         state.player->movement = glm::normalize(state.player->movement);
     }
+    
+    if (state.player->acceleration.x != 0) state.player->Wake();
 
 }
 
@@ -353,6 +372,15 @@ void Update() {
         // Update. Notice it's FIXED_TIMESTEP. Not deltaTime
         state.player->Update(FIXED_TIMESTEP, state.platforms, PLATFORM_COUNT, state.walls, WALL_COUNT);
         
+        // The exhaust leaves the thruster on the side away from the push.
+        Entity *player = state.player;
+        if (player->acceleration.x != 0 && player->isDead == false && player->hasWon == false) {
+            float side = player->acceleration.x > 0 ? -1.0f : 1.0f;
+            thruster.angle = side > 0 ? 0.0f : 3.14159265f;
+            exhaust.Emit(thruster, glm::vec2(player->position.x + side * player->width / 2, player->position.y), FIXED_TIMESTEP);
+        }
+        exhaust.Update(FIXED_TIMESTEP);
+        
         deltaTime -= FIXED_TIMESTEP;
     }
     
@@ -370,6 +398,8 @@ void Render() {
         state.walls[i].Render(&program);
     }
     
+    exhaust.Render(&particleProgram);
+    
     state.player->Render(&program);
     
     if (state.player->isDead) {
@@ -386,6 +416,7 @@ void Render() {
 
 
 void Shutdown() {
+    exhaust.Free();
     SDL_Quit();
 }
 
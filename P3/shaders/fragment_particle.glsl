@@ -0,0 +1,6 @@
+uniform vec4 color;
+varying float alphaVar;
+
+void main() {
+    gl_FragColor = vec4(color.rgb, color.a * alphaVar);
+}
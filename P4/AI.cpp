@@ -0,0 +1,119 @@
+#include "AI.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(DETERMINISTIC_MATH)
+#define AI_USE_SSE 1
+#endif
+
+// Squared, so the range check needs no sqrt.
+#define PUNCH_RANGE_SQUARED 0.25f
+#define SHOOT_RANGE_SQUARED 36.0f
+#define SHOOTER_RELOAD 1.5f
+
+static bool CompareAIType(const Entity &a, const Entity &b){
+    return a.aiType < b.aiType;
+}
+
+void AISystem::Build(Entity *enemies, int enemyCount){
+    this->enemies = enemies;
+    this->enemyCount = enemyCount;
+
+    std::stable_sort(enemies, enemies + enemyCount, CompareAIType);
+
+    int index = 0;
+    for (int type = 0; type < AI_TYPE_COUNT; type++) {
+        batchBegin[type] = index;
+        while (index < enemyCount && enemies[index].aiType == type) index++;
+        batchEnd[type] = index;
+    }
+}
+
+// Patrol: start in the default direction, keep going and turn around on a
+// side hit or at a ledge.
+void AISystem::Walk(int begin, int end, Real direction){
+    for (int i = begin; i < end; i++) {
+        Entity &enemy = enemies[i];
+        if (enemy.updateDue == false) continue;
+        Real heading = enemy.movement.x != 0 ? enemy.movement.x : direction;
+        Real x = enemy.collidedLeft ? Real(1) : (enemy.collidedRight ? Real(-1) : heading);
+        enemy.movement = RealVec3(x, 0, 0);
+    }
+}
+
+// One table lookup per enemy, however many there are.
+void AISystem::Chase(int begin, int end){
+    for (int i = begin; i < end; i++) {
+        if (enemies[i].updateDue) enemies[i].movement = field->Direction(enemies[i].position);
+    }
+}
+
+void AISystem::UpdatePunchers(Entity *player){
+    int begin = batchBegin[PUNCHER];
+    int end = batchEnd[PUNCHER];
+
+    for (int i = begin; i < end; i++) {
+        if (enemies[i].isActive && enemies[i].updateDue && enemies[i].aiState == ATTACKING) player->isDead = true;
+    }
+
+    if (field != NULL) Chase(begin, end);
+    else Walk(begin, end, -1);
+
+    int i = begin;
+#ifdef AI_USE_SSE
+    __m128 px = _mm_set1_ps(player->position.x);
+    __m128 py = _mm_set1_ps(player->position.y);
+    __m128 pz = _mm_set1_ps(player->position.z);
+    __m128 range = _mm_set1_ps(PUNCH_RANGE_SQUARED);
+
+    for (; i + 4 <= end; i += 4) {
+        Entity *e = &enemies[i];
+        __m128 dx = _mm_sub_ps(_mm_setr_ps(e[0].position.x, e[1].position.x, e[2].position.x, e[3].position.x), px);
+        __m128 dy = _mm_sub_ps(_mm_setr_ps(e[0].position.y, e[1].position.y, e[2].position.y, e[3].position.y), py);
+        __m128 dz = _mm_sub_ps(_mm_setr_ps(e[0].position.z, e[1].position.z, e[2].position.z, e[3].position.z), pz);
+        __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        int inRange = _mm_movemask_ps(_mm_cmplt_ps(dist, range));
+
+        if (inRange == 0) continue;
+        for (int lane = 0; lane < 4; lane++) {
+            if ((inRange & (1 << lane)) && e[lane].isActive && e[lane].updateDue && e[lane].aiState == WALKING) e[lane].aiState = ATTACKING;
+        }
+    }
+#endif
+    for (; i < end; i++) {
+        Entity &enemy = enemies[i];
+        if (enemy.isActive == false || enemy.updateDue == false || enemy.aiState != WALKING) continue;
+
+        Real dx = enemy.position.x - player->position.x;
+        Real dy = enemy.position.y - player->position.y;
+        Real dz = enemy.position.z - player->position.z;
+        if (dx * dx + dy * dy + dz * dz < PUNCH_RANGE_SQUARED) enemy.aiState = ATTACKING;
+    }
+}
+
+// Fires straight at the player once reloaded and in range.
+void AISystem::Shoot(Entity *player){
+    for (int i = batchBegin[SHOOTER]; i < batchEnd[SHOOTER]; i++) {
+        Entity &enemy = enemies[i];
+        if (enemy.isActive == false || enemy.updateDue == false) continue;
+
+        enemy.reloadTime -= enemy.updateTime;
+        if (enemy.reloadTime > 0) continue;
+
+        float dx = (float)(player->position.x - enemy.position.x);
+        float dy = (float)(player->position.y - enemy.position.y);
+        float distance = dx * dx + dy * dy;
+        if (distance > SHOOT_RANGE_SQUARED || distance == 0) continue;
+
+        float speed = PROJECTILE_SPEED / sqrtf(distance);
+        if (projectiles->Spawn((float)enemy.position.x, (float)enemy.position.y, dx * speed, dy * speed)) enemy.reloadTime = SHOOTER_RELOAD;
+    }
+}
+
+void AISystem::Update(Entity *player){
+    Walk(batchBegin[STABBER], batchEnd[STABBER], -1);
+    Walk(batchBegin[SHOOTER], batchEnd[SHOOTER], 1);
+    if (projectiles != NULL) Shoot(player);
+    UpdatePunchers(player);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Entity.h"
+#include "FlowField.h"
+#include "Projectile.h"
+
+// Runs enemy behaviours one AIType at a time. Build() sorts the enemy array
+// so each type is a contiguous range, then Update() runs one tight loop per
+// range instead of switching on aiType for every enemy. Enemies the
+// UpdateScheduler skipped this step keep their last decision.
+class AISystem {
+public:
+    Entity *enemies = NULL;
+    int enemyCount = 0;
+
+    // Punchers chase the player along this field when set, and patrol otherwise.
+    FlowField *field = NULL;
+
+    // Shooters fire at the player into this pool when set.
+    ProjectileSystem *projectiles = NULL;
+
+    int batchBegin[AI_TYPE_COUNT];
+    int batchEnd[AI_TYPE_COUNT];
+
+    void Build(Entity *enemies, int enemyCount);
+    void Update(Entity *player);
+
+private:
+    void Walk(int begin, int end, Real direction);
+    void Chase(int begin, int end);
+    void UpdatePunchers(Entity *player);
+    void Shoot(Entity *player);
+};
@@ -0,0 +1,52 @@
+#include "Animation.h"
+
+AnimationLibrary animations;
+
+int AnimationLibrary::AddAtlas(int cols, int rows){
+    if (rectCount + cols * rows > MAX_ATLAS_FRAMES) return -1;
+
+    int start = rectCount;
+    float width = 1.0f / (float)cols;
+    float height = 1.0f / (float)rows;
+
+    for (int index = 0; index < cols * rows; index++) {
+        UVRect &rect = rects[rectCount++];
+        rect.u = (float)(index % cols) * width;
+        rect.v = (float)(index / cols) * height;
+        rect.width = width;
+        rect.height = height;
+    }
+    return start;
+}
+
+int AnimationLibrary::AddClip(int atlasStart, const int *cells, int cellCount, float frameDuration){
+    if (clipCount >= MAX_ANIMATION_CLIPS || cellCount > MAX_CLIP_FRAMES) return -1;
+
+    AnimationClip &clip = clips[clipCount];
+    for (int i = 0; i < cellCount; i++) {
+        clip.frames[i] = atlasStart + cells[i];
+    }
+    clip.frameCount = cellCount;
+    clip.frameDuration = frameDuration;
+    return clipCount++;
+}
+
+void AnimationLibrary::Advance(Entity *entities, int count){
+    for (int i = 0; i < count; i++) {
+        Entity &entity = entities[i];
+        if (entity.animClip < 0 || entity.isActive == false || entity.updateDue == false) continue;
+
+        if (entity.movement == RealVec3(0)) {
+            entity.animFrame = 0;
+            continue;
+        }
+
+        const AnimationClip &clip = clips[entity.animClip];
+        entity.animTime += entity.updateTime;
+        if (entity.animTime >= clip.frameDuration) {
+            entity.animTime = 0.0f;
+            entity.animFrame++;
+            if (entity.animFrame >= clip.frameCount) entity.animFrame = 0;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Entity.h"
+
+#define MAX_ATLAS_FRAMES 256
+#define MAX_ANIMATION_CLIPS 32
+#define MAX_CLIP_FRAMES 16
+
+// Texture coordinates of one cell in a sprite atlas.
+struct UVRect {
+    float u;
+    float v;
+    float width;
+    float height;
+};
+
+// A sequence of atlas cells shared by every entity that plays it. frames[]
+// holds indices into AnimationLibrary::rects, not raw atlas cells.
+struct AnimationClip {
+    int frames[MAX_CLIP_FRAMES];
+    int frameCount;
+    float frameDuration;
+};
+
+// Owns all atlases and clips. Entities only keep a clip ID, the current
+// frame and the time spent on it.
+class AnimationLibrary {
+public:
+    UVRect rects[MAX_ATLAS_FRAMES];
+    int rectCount = 0;
+
+    AnimationClip clips[MAX_ANIMATION_CLIPS];
+    int clipCount = 0;
+
+    // Precomputes the UVs of every cell; returns the rect index of cell 0.
+    int AddAtlas(int cols, int rows);
+
+    // cells are indices into the atlas starting at atlasStart. Returns the clip ID.
+    int AddClip(int atlasStart, const int *cells, int cellCount, float frameDuration = 0.25f);
+
+    const UVRect &Frame(int clip, int frame) const { return rects[clips[clip].frames[frame]]; }
+
+    // Advances every animated, active entity that is due this step by its
+    // updateTime, in one pass.
+    void Advance(Entity *entities, int count);
+};
+
+extern AnimationLibrary animations;
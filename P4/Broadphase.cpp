@@ -0,0 +1,126 @@
+#include "Broadphase.h"
+
+#include <algorithm>
+
+// At equal values a min sorts before a max, so boxes that only touch are still
+// tested; the y test below then rejects them exactly like CheckCollision.
+static bool EndpointLess(const SweepEndpoint &a, const SweepEndpoint &b){
+    if (a.value < b.value) return true;
+    if (b.value < a.value) return false;
+    return !a.isMax && b.isMax;
+}
+
+static bool Overlaps(const Entity *a, const Entity *b){
+    Real xdist = fabs(a->position.x - b->position.x) - ((a->width + b->width) / 2.0f);
+    Real ydist = fabs(a->position.y - b->position.y) - ((a->height + b->height) / 2.0f);
+    return xdist < 0 && ydist < 0;
+}
+
+void SweepAndPrune::Add(Entity *body){
+    int index = (int)bodies.size();
+    bodies.push_back(body);
+    boxes.push_back(SweepBox());
+
+    SweepEndpoint endpoint;
+    endpoint.body = index;
+    endpoint.isMax = false;
+    endpoints.push_back(endpoint);
+    endpoint.isMax = true;
+    endpoints.push_back(endpoint);
+
+    needsFullSort = true;
+}
+
+void SweepAndPrune::Clear(){
+    bodies.clear();
+    endpoints.clear();
+    pairs.clear();
+    boxes.clear();
+    open.clear();
+    needsFullSort = false;
+}
+
+void SweepAndPrune::Sort(){
+    for (size_t i = 0; i < bodies.size(); i++) {
+        Entity *body = bodies[i];
+        SweepBox &box = boxes[i];
+        Real halfWidth = body->width / 2.0f;
+        Real halfHeight = body->height / 2.0f;
+        box.minX = body->position.x - halfWidth;
+        box.maxX = body->position.x + halfWidth;
+        box.minY = body->position.y - halfHeight;
+        box.maxY = body->position.y + halfHeight;
+        box.isActive = body->isActive;
+    }
+
+    int count = (int)endpoints.size();
+    for (int i = 0; i < count; i++) {
+        SweepEndpoint &endpoint = endpoints[i];
+        const SweepBox &box = boxes[endpoint.body];
+        endpoint.value = endpoint.isMax ? box.maxX : box.minX;
+        endpoint.minY = box.minY;
+        endpoint.maxY = box.maxY;
+        endpoint.isActive = box.isActive;
+    }
+
+    swapCount = 0;
+    if (needsFullSort) {
+        std::sort(endpoints.begin(), endpoints.end(), EndpointLess);
+        needsFullSort = false;
+        return;
+    }
+
+    for (int i = 1; i < count; i++) {
+        SweepEndpoint endpoint = endpoints[i];
+        int j = i;
+        while (j > 0 && EndpointLess(endpoint, endpoints[j - 1])) {
+            endpoints[j] = endpoints[j - 1];
+            j--;
+        }
+        endpoints[j] = endpoint;
+        swapCount += i - j;
+    }
+}
+
+// Walks the endpoints left to right keeping the set of open boxes. A box that
+// opens overlaps on x with every box open at that point; the y ranges reject
+// most of those before the exact test on the entities.
+void SweepAndPrune::Sweep(){
+    pairs.clear();
+
+    int count = (int)endpoints.size();
+    for (int i = 0; i < count; i++) {
+        int index = endpoints[i].body;
+
+        // Only boxes overlapping this one on x are open, so the list is short.
+        if (endpoints[i].isMax) {
+            for (size_t j = 0; j < open.size(); j++) {
+                if (open[j].body != index) continue;
+                open[j] = open.back();
+                open.pop_back();
+                break;
+            }
+            continue;
+        }
+
+        const SweepEndpoint &box = endpoints[i];
+        if (box.isActive == false) continue;
+
+        for (size_t j = 0; j < open.size(); j++) {
+            if (open[j].maxY < box.minY || box.maxY < open[j].minY) continue;
+            Entity *other = bodies[open[j].body];
+            if (Overlaps(other, bodies[index])) {
+                EntityPair pair = { other, bodies[index] };
+                pairs.push_back(pair);
+            }
+        }
+
+        SweepOpenBox entry = { index, box.minY, box.maxY };
+        open.push_back(entry);
+    }
+}
+
+void SweepAndPrune::Update(){
+    Sort();
+    Sweep();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include "Entity.h"
+
+// One end of a body's box on the x axis. The y range and active flag ride
+// along so the sweep does not have to look the body up.
+struct SweepEndpoint {
+    Real value;
+    int body;
+    bool isMax;
+    bool isActive;
+    Real minY, maxY;
+};
+
+// A body's box, read out of the entities in order once per step.
+struct SweepBox {
+    Real minX, maxX;
+    Real minY, maxY;
+    bool isActive;
+};
+
+// An entry of the sweep's open list. The y range is copied in so the inner
+// loop scans one contiguous array.
+struct SweepOpenBox {
+    int body;
+    Real minY, maxY;
+};
+
+struct EntityPair {
+    Entity *a;
+    Entity *b;
+};
+
+// Sweep-and-prune broadphase for moving entities. The min and max x of every
+// box stay in one sorted array from step to step. Bodies only move a little
+// per step, so insertion sort puts it back in order in close to O(n). A sweep
+// over the endpoints then only tests boxes that already overlap on x.
+class SweepAndPrune {
+public:
+    std::vector<Entity *> bodies;
+    std::vector<SweepEndpoint> endpoints;
+
+    // Overlapping pairs of active bodies found by the last Update, in sweep order.
+    std::vector<EntityPair> pairs;
+
+    // Endpoint swaps made by the last Update's insertion sort.
+    int swapCount = 0;
+
+    void Add(Entity *body);
+    void Clear();
+
+    void Update();
+
+private:
+    bool needsFullSort = false;
+
+    std::vector<SweepBox> boxes;
+    std::vector<SweepOpenBox> open;
+
+    void Sort();
+    void Sweep();
+};
@@ -1,21 +1,22 @@
 #include "Entity.h"
+#include "Animation.h"
 
 Entity::Entity()
 {
-    position = glm::vec3(0);
-    movement = glm::vec3(0);
-    acceleration = glm::vec3(0);
-    velocity = glm::vec3(0);
+    position = RealVec3(0);
+    movement = RealVec3(0);
+    acceleration = RealVec3(0);
+    velocity = RealVec3(0);
     speed = 0;
     
-    modelMatrix = glm::mat4(1.0f);
+    modelMatrix = glm::mat3x2(1.0f);
 }
 
 bool Entity::CheckCollision(Entity *other){
     if(isActive == false || other->isActive == false) return false;
     
-    float xdist = fabs(position.x - other->position.x) - ((width + other->width) / 2.0f);
-    float ydist = fabs(position.y - other->position.y) - ((height + other->height) / 2.0f);
+    Real xdist = fabs(position.x - other->position.x) - ((width + other->width) / 2.0f);
+    Real ydist = fabs(position.y - other->position.y) - ((height + other->height) / 2.0f);
     
     if (xdist < 0 && ydist < 0) return true;
     return false;
@@ -27,8 +28,8 @@ void Entity::CheckCollisionsY(Entity *objects, int objectCount){
         Entity *object = &objects[i];
         
         if (CheckCollision(object)){
-            float ydist = fabs(position.y - object->position.y);
-            float penetrationY = fabs(ydist - (height / 2.0f) - (object->height / 2.0f));
+            Real ydist = fabs(position.y - object->position.y);
+            Real penetrationY = fabs(ydist - (height / 2.0f) - (object->height / 2.0f));
             if (velocity.y > 0) {
                 position.y -= penetrationY;
                 velocity.y = 0;
@@ -47,8 +48,8 @@ void Entity::CheckCollisionsX(Entity *objects, int objectCount){
     for (int i = 0; i < objectCount; i++){
         Entity *object = &objects[i];
         if (CheckCollision(object)){
-            float xdist = fabs(position.x - object->position.x);
-            float penetrationX = fabs(xdist - (width / 2.0f) - (object->width / 2.0f));
+            Real xdist = fabs(position.x - object->position.x);
+            Real penetrationX = fabs(xdist - (width / 2.0f) - (object->width / 2.0f));
             if (velocity.x > 0) {
                 position.x -= penetrationX;
                 velocity.x = 0;
@@ -63,130 +64,55 @@ void Entity::CheckCollisionsX(Entity *objects, int objectCount){
     }
 }
 
-void Entity:: JumpEnemy(Entity* enemies, int enemyCount){
-    for (int i = 0; i < enemyCount; i++) {
-        collidedBottom = false;
-
-        Entity* Enemy = &enemies[i];
-
-        if (CheckCollision(Enemy) && Enemy->isActive) {
-            if (velocity.y < 0 && position.y > Enemy->position.y) {
-                collidedBottom = true;
-                Enemy->isActive = false;
-            }
-
-            else {
-                isDead = true;
-            }
+void Entity::JumpEnemy(Entity *enemy){
+    if (CheckCollision(enemy) && enemy->isActive) {
+        if (velocity.y < 0 && position.y > enemy->position.y) {
+            collidedBottom = true;
+            enemy->isActive = false;
         }
 
+        else {
+            isDead = true;
+        }
     }
 }
 
-void Entity::AIStabber(Entity* player){
-    movement = glm::vec3(-1, 0, 0);
-    
-    if(collidedRight){
-        movement = glm::vec3(-1, 0, 0);
-    }
-    else if (collidedLeft){
-        movement = glm::vec3(1, 0, 0);
-    }
-}
+void Entity:: JumpEnemy(Entity* enemies, int enemyCount){
+    for (int i = 0; i < enemyCount; i++) {
+        collidedBottom = false;
 
-void Entity::AIShooter(Entity *player){
-    movement = glm::vec3(1, 0, 0);
-    
-    if(collidedRight){
-        movement = glm::vec3(-1, 0, 0);
-    }
-    else if (collidedLeft){
-        movement = glm::vec3(1, 0, 0);
+        JumpEnemy(&enemies[i]);
     }
 }
 
-void Entity::AIPuncher(Entity *player){
-    switch(aiState){
-
-        case WALKING:
-//            if(player->position.x < position.x){
-//                movement = glm::vec3(-1, 0, 0);
-//            }
-//            else{
-//                movement = glm::vec3(1, 0, 0);
-//            }
-            
-            movement = glm::vec3(-1, 0, 0);
-            
-            if(collidedRight){
-                movement = glm::vec3(-1, 0, 0);
-            }
-            else if (collidedLeft){
-                movement = glm::vec3(1, 0, 0);
-            }
-            
-            if(glm::distance(position, player->position) < 0.5f){
-                aiState = ATTACKING;
-            }
-            break;
-
-        case ATTACKING:
-            player->isDead = true;
-            break;
-
-    }
+void Entity::CountRest(){
+    bool resting = fabs(velocity.x) < SLEEP_SPEED && fabs(velocity.y) < SLEEP_SPEED && movement == RealVec3(0) && jump == false && collidedBottom;
+    restSteps = resting ? restSteps + 1 : 0;
+    if (restSteps >= SLEEP_STEPS) isSleeping = true;
 }
 
-void Entity::AI(Entity* player){
-    switch (aiType){
-            
-        case STABBER:
-            AIStabber(player);
-            break;
-            
-        case SHOOTER:
-            AIShooter(player);
-            break;
-            
-        case PUNCHER:
-            AIPuncher(player);
-            break;
+bool Entity::HasGroundAhead(Entity *platforms, int platformCount, Real direction){
+    Real x = position.x + direction * (width / 2.0f);
+    Real y = position.y - height / 2.0f - LEDGE_PROBE;
+    for (int i = 0; i < platformCount; i++) {
+        Entity &platform = platforms[i];
+        if (platform.isActive == false) continue;
+        if (fabs(x - platform.position.x) <= platform.width / 2.0f && fabs(y - platform.position.y) <= platform.height / 2.0f) return true;
     }
+    return false;
 }
 
-
-
-void Entity::Update(float deltaTime, Entity *player, Entity *platforms, int platformCount, Entity *enemies, int enemiesCount){
+void Entity::Update(float frameTime, Entity *platforms, int platformCount, Entity *enemies, int enemiesCount){
     
-    if(isActive == false) return;
+    if(isActive == false || isSleeping) return;
+    
+    Real deltaTime = frameTime;
     
     collidedTop = false;
     collidedBottom = false;
     collidedLeft = false;
     collidedRight = false;
     
-    if (entityType == ENEMY){
-        AI(player);
-    }
-    
-    if (animIndices != NULL) {
-        if (glm::length(movement) != 0) {
-            animTime += deltaTime;
-
-            if (animTime >= 0.25f)
-            {
-                animTime = 0.0f;
-                animIndex++;
-                if (animIndex >= animFrames)
-                {
-                    animIndex = 0;
-                }
-            }
-        } else {
-            animIndex = 0;
-        }
-    }
-    
 //    for (int i = 0; i < platformCount; i++){
 //        if(CheckCollision(&platforms[i])) return; //if collide, return
 //    }
@@ -209,6 +135,31 @@ void Entity::Update(float deltaTime, Entity *player, Entity *platforms, int plat
         CheckCollisionsX(platforms, platformCount);// Fix if needed
         
         JumpEnemy(enemies, enemiesCount);
+        CountRest();
+        
+        transformDirty = true;
+    }
+    else if (entityType == ENEMY){
+        // The AI only sets movement; enemies fall and collide like the player.
+        velocity.x = movement.x * speed;
+        velocity += acceleration * deltaTime;
+        
+        position.y += velocity.y * deltaTime;
+        CheckCollisionsY(platforms, platformCount);
+        
+        Real stepX = velocity.x * deltaTime;
+        position.x += stepX;
+        CheckCollisionsX(platforms, platformCount);
+        
+        // A ledge stops an enemy like a wall, so patrols turn around instead of falling off.
+        if (collidedBottom && velocity.x != 0 && !HasGroundAhead(platforms, platformCount, velocity.x > 0 ? Real(1) : Real(-1))) {
+            position.x -= stepX;
+            if (velocity.x > 0) collidedRight = true;
+            else collidedLeft = true;
+            velocity.x = 0;
+        }
+        
+        transformDirty = true;
     }
     
 //      for (int i = 0; i < platformCount; i++){
@@ -227,18 +178,14 @@ void Entity::Update(float deltaTime, Entity *player, Entity *platforms, int plat
 //              }
 //          }
 //      }
-    
-    modelMatrix = glm::mat4(1.0f);
-    modelMatrix = glm::translate(modelMatrix, position);
 }
 
-void Entity::DrawSpriteFromTextureAtlas(ShaderProgram *program, GLuint textureID, int index)
+void Entity::DrawSpriteFromTextureAtlas(ShaderProgram *program, GLuint textureID, const UVRect &frame)
 {
-    float u = (float)(index % animCols) / (float)animCols;
-    float v = (float)(index / animCols) / (float)animRows;
-    
-    float width = 1.0f / (float)animCols;
-    float height = 1.0f / (float)animRows;
+    float u = frame.u;
+    float v = frame.v;
+    float width = frame.width;
+    float height = frame.height;
     
     float texCoords[] = { u, v + height, u + width, v + height, u + width, v,
         u, v + height, u + width, v, u, v};
@@ -265,8 +212,8 @@ void Entity::Render(ShaderProgram *program) {
     
     program->SetModelMatrix(modelMatrix);
     
-    if (animIndices != NULL) {
-        DrawSpriteFromTextureAtlas(program, textureID, animIndices[animIndex]);
+    if (animClip >= 0) {
+        DrawSpriteFromTextureAtlas(program, textureID, animations.Frame(animClip, animFrame));
         return;
     }
     
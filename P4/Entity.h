@@ -1,3 +1,5 @@
+#pragma once
+
 #define GL_SILENCE_DEPRECATION
 
 #ifdef _WINDOWS
@@ -9,51 +11,84 @@
 #include <SDL_opengl.h>
 #include "glm/mat4x4.hpp"
 #include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtx/matrix_transform_2d.hpp"
 #include "ShaderProgram.h"
+#include "Fixed.h"
 
 enum EntityType {PLAYER, PLATFORM, ENEMY};
-enum AIType { STABBER, SHOOTER, PUNCHER };
+
+// How far below its feet an enemy looks for ground before stepping on.
+#define LEDGE_PROBE 0.05f
+
+// An entity that stays slower than SLEEP_SPEED, with no input and standing
+// on something, for SLEEP_STEPS steps in a row goes to sleep.
+#define SLEEP_SPEED 0.01f
+#define SLEEP_STEPS 30
+
+enum AIType { STABBER, SHOOTER, PUNCHER, AI_TYPE_COUNT };
 enum AIState { WALKING, ATTACKING };
 
+struct UVRect;
+
 class Entity {
 public:
     EntityType entityType;
     AIType aiType;
     AIState aiState;
     
-    glm::vec3 position;
-    glm::vec3 movement;
-    glm::vec3 acceleration;
-    glm::vec3 velocity;
+    RealVec3 position;
+    RealVec3 movement;
+    RealVec3 acceleration;
+    RealVec3 velocity;
     
-    float width = 1;
-    float height = 1;
+    Real width = 1;
+    Real height = 1;
     
     bool jump = false;
-    float jumpPower = 0;
+    Real jumpPower = 0;
     
-    float speed;
+    Real speed;
     
     GLuint textureID;
     
-    glm::mat4 modelMatrix;
-    
-    int *animRight = NULL;
-    int *animLeft = NULL;
-    int *animUp = NULL;
-    int *animDown = NULL;
+    // World transform (2D affine), rebuilt by the TransformSystem. Set transformDirty after
+    // moving the entity; parent is an index into the same entity array.
+    // position is always in world space; a child moves by its localPosition,
+    // its offset from the parent, and the TransformSystem keeps position in step.
+    glm::mat3x2 modelMatrix;
+    bool transformDirty = true;
+    int parent = -1;
+    RealVec3 localPosition = RealVec3(0);
+    
+    // Clip IDs from the AnimationLibrary, -1 when unused.
+    int animRight = -1;
+    int animLeft = -1;
+    int animUp = -1;
+    int animDown = -1;
 
-    int *animIndices = NULL;
-    int animFrames = 0;
-    int animIndex = 0;
+    int animClip = -1;
+    int animFrame = 0;
     float animTime = 0;
-    int animCols = 0;
-    int animRows = 0;
+    
+    // Set by the UpdateScheduler. updateTime is how much time the entity has
+    // to simulate when updateDue is set, covering the steps it skipped;
+    // updateStep is the first step it has not simulated yet.
+    int updateTier = 0;
+    bool updateDue = true;
+    float updateTime = 0;
+    unsigned int updateStep = 0;
+    
+    // Time until a shooter can fire again.
+    float reloadTime = 0;
     
     bool isActive = true;
     
     bool isDead = false;
     
+    // Sleeping entities skip Update until the SleepSystem wakes them.
+    bool isSleeping = false;
+    int restSteps = 0;
+    
     bool collidedTop = false;
     bool collidedBottom = false;
     bool collidedLeft = false;
@@ -65,16 +100,17 @@ public:
     void CheckCollisionsY(Entity *objects, int objectCount);
     void CheckCollisionsX(Entity *objects, int objectCount);
     
+    // Stomps the enemy when landing on it from above, dies otherwise.
+    void JumpEnemy(Entity *enemy);
     void JumpEnemy(Entity* enemies, int enemycount);
     
-    void Update(float deltaTime, Entity *player, Entity *platforms, int platformCount, Entity *enemies, int enemiesCount);
-    void Render(ShaderProgram *program);
-    void DrawSpriteFromTextureAtlas(ShaderProgram *program, GLuint textureID, int index);
+    void CountRest();
     
-    void AI(Entity* player);
+    // True when a platform is under the front edge, one step of direction (+1 or -1) ahead.
+    bool HasGroundAhead(Entity *platforms, int platformCount, Real direction);
     
-    void AIStabber(Entity* player);
-    void AIShooter(Entity *player);
-    void AIPuncher(Entity *player);
+    void Update(float deltaTime, Entity *platforms, int platformCount, Entity *enemies, int enemiesCount);
+    void Render(ShaderProgram *program);
+    static void DrawSpriteFromTextureAtlas(ShaderProgram *program, GLuint textureID, const UVRect &frame);
     
 };
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+#include <cmath>
+#include "glm/vec3.hpp"
+
+// 16.16 fixed-point number. All arithmetic is done on integers so results
+// are the same whatever the compiler, optimisation level or -ffast-math.
+struct fixed {
+    int32_t raw;
+
+    fixed() = default;
+    fixed(int value) : raw(value * 65536) {}
+    fixed(float value) : raw((int32_t)(value * 65536.0f)) {}
+    fixed(double value) : raw((int32_t)(value * 65536.0)) {}
+
+    static fixed FromRaw(int32_t raw) { fixed f; f.raw = raw; return f; }
+
+    explicit operator float() const { return (float)raw / 65536.0f; }
+    explicit operator double() const { return (double)raw / 65536.0; }
+    explicit operator int() const { return raw / 65536; }
+
+    fixed operator-() const { return FromRaw(-raw); }
+
+    fixed &operator+=(fixed other) { raw += other.raw; return *this; }
+    fixed &operator-=(fixed other) { raw -= other.raw; return *this; }
+    fixed &operator*=(fixed other) { raw = (int32_t)(((int64_t)raw * other.raw) >> 16); return *this; }
+    fixed &operator/=(fixed other) { raw = (int32_t)(((int64_t)raw << 16) / other.raw); return *this; }
+};
+
+inline fixed operator+(fixed a, fixed b) { return a += b; }
+inline fixed operator-(fixed a, fixed b) { return a -= b; }
+inline fixed operator*(fixed a, fixed b) { return a *= b; }
+inline fixed operator/(fixed a, fixed b) { return a /= b; }
+
+inline bool operator==(fixed a, fixed b) { return a.raw == b.raw; }
+inline bool operator!=(fixed a, fixed b) { return a.raw != b.raw; }
+inline bool operator<(fixed a, fixed b) { return a.raw < b.raw; }
+inline bool operator>(fixed a, fixed b) { return a.raw > b.raw; }
+inline bool operator<=(fixed a, fixed b) { return a.raw <= b.raw; }
+inline bool operator>=(fixed a, fixed b) { return a.raw >= b.raw; }
+
+inline fixed fabs(fixed a) { return a.raw < 0 ? -a : a; }
+
+// Scalar used by the Entity physics. Build with -DDETERMINISTIC_MATH to get
+// bit-identical simulation (and replays) across builds.
+#ifdef DETERMINISTIC_MATH
+typedef fixed Real;
+#else
+typedef float Real;
+#endif
+
+typedef glm::vec<3, Real> RealVec3;
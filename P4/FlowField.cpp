@@ -0,0 +1,200 @@
+#include "FlowField.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#define FLOW_DIAGONAL 0.70710678f
+
+// FLOW_NONE maps to the zero vector.
+static const int stepX[9] = { 1, 1, 0, -1, -1, -1, 0, 1, 0 };
+static const int stepY[9] = { 0, 1, 1, 1, 0, -1, -1, -1, 0 };
+static const float unitX[9] = { 1, FLOW_DIAGONAL, 0, -FLOW_DIAGONAL, -1, -FLOW_DIAGONAL, 0, FLOW_DIAGONAL, 0 };
+static const float unitY[9] = { 0, FLOW_DIAGONAL, 1, FLOW_DIAGONAL, 0, -FLOW_DIAGONAL, -1, -FLOW_DIAGONAL, 0 };
+
+void FlowField::Init(int width, int height, RealVec3 origin, Real tileSize){
+    Free();
+
+    this->width = width;
+    this->height = height;
+    this->origin = origin;
+    this->tileSize = tileSize;
+
+    blocked.Init(width, height, 0);
+    distance.Init(width, height, FLOW_UNREACHED);
+    direction.Init(width, height, FLOW_NONE);
+    backDistance.Init(width, height, FLOW_UNREACHED);
+    backDirection.Init(width, height, FLOW_NONE);
+    distance.outside = backDistance.outside = FLOW_UNREACHED;
+    direction.outside = backDirection.outside = FLOW_NONE;
+
+    queue.resize((size_t)width * height);
+    targetX = targetY = -1;
+    requestX = requestY = -1;
+    computeCount = 0;
+}
+
+void FlowField::Free(){
+    StopWorker();
+    blocked.Free();
+    distance.Free();
+    direction.Free();
+    backDistance.Free();
+    backDirection.Free();
+    queue.clear();
+    width = height = 0;
+}
+
+bool FlowField::CellOf(RealVec3 position, int *x, int *y) const {
+    *x = (int)std::floor((float)((position.x - origin.x) / tileSize));
+    *y = (int)std::floor((float)((position.y - origin.y) / tileSize));
+    return blocked.Contains(*x, *y);
+}
+
+void FlowField::Block(RealVec3 centre, Real width, Real height){
+    int x0 = (int)std::floor((float)((centre.x - width / 2.0f - origin.x) / tileSize));
+    int y0 = (int)std::floor((float)((centre.y - height / 2.0f - origin.y) / tileSize));
+    int x1 = (int)std::ceil((float)((centre.x + width / 2.0f - origin.x) / tileSize));
+    int y1 = (int)std::ceil((float)((centre.y + height / 2.0f - origin.y) / tileSize));
+    blocked.ForEachInRect(x0, y0, x1, y1, [](int, int, glm::uint8 &tile){ tile = 1; });
+}
+
+// blocked, distance and direction have the same size, so one Morton code
+// addresses all three. Neighbours are reached by stepping the per-axis codes
+// rather than encoding each one.
+void FlowField::Compute(int x, int y, TileGrid<glm::uint16> &distance, TileGrid<glm::uint8> &direction){
+    std::fill(distance.tiles, distance.tiles + distance.capacity, (glm::uint16)FLOW_UNREACHED);
+    std::fill(direction.tiles, direction.tiles + direction.capacity, (glm::uint8)FLOW_NONE);
+    if (!blocked.Contains(x, y) || blocked.At(x, y)) return;
+
+    // Breadth-first over the four sides; queue entries are y << 16 | x.
+    size_t head = 0, tail = 0;
+    distance.At(x, y) = 0;
+    queue[tail++] = (glm::uint32)y << 16 | (glm::uint32)x;
+    while (head < tail) {
+        int cx = queue[head] & 0xFFFF;
+        int cy = queue[head] >> 16;
+        head++;
+
+        size_t xCode = blocked.XCode(cx), yCode = blocked.YCode(cy);
+        glm::uint16 next = distance.tiles[xCode | yCode] + 1;
+        size_t codes[4] = {
+            cx + 1 < width ? blocked.NextX(xCode) | yCode : SIZE_MAX,
+            cy + 1 < height ? xCode | blocked.NextY(yCode) : SIZE_MAX,
+            cx > 0 ? blocked.PrevX(xCode) | yCode : SIZE_MAX,
+            cy > 0 ? xCode | blocked.PrevY(yCode) : SIZE_MAX,
+        };
+        for (int k = 0; k < 4; k++) {
+            size_t code = codes[k];
+            if (code == SIZE_MAX || blocked.tiles[code] || distance.tiles[code] != FLOW_UNREACHED) continue;
+            distance.tiles[code] = next;
+            queue[tail++] = (glm::uint32)(cy + stepY[2 * k]) << 16 | (glm::uint32)(cx + stepX[2 * k]);
+        }
+    }
+
+    // Point every reached tile at its lowest neighbour. A diagonal is only
+    // taken when both tiles beside it are reachable, so no corner is cut.
+    for (size_t i = 1; i < tail; i++) {
+        int cx = queue[i] & 0xFFFF;
+        int cy = queue[i] >> 16;
+
+        size_t xCode = blocked.XCode(cx), yCode = blocked.YCode(cy);
+        size_t xCodes[3] = { blocked.PrevX(xCode), xCode, blocked.NextX(xCode) };
+        size_t yCodes[3] = { blocked.PrevY(yCode), yCode, blocked.NextY(yCode) };
+        glm::uint16 around[3][3];
+        for (int dy = 0; dy < 3; dy++)
+            for (int dx = 0; dx < 3; dx++) {
+                bool inside = blocked.Contains(cx + dx - 1, cy + dy - 1);
+                around[dy][dx] = inside ? distance.tiles[xCodes[dx] | yCodes[dy]] : (glm::uint16)FLOW_UNREACHED;
+            }
+
+        glm::uint16 best = around[1][1];
+        glm::uint8 bestStep = FLOW_NONE;
+        for (int k = 0; k < 8; k++) {
+            int dx = stepX[k] + 1, dy = stepY[k] + 1;
+            if (around[dy][dx] >= best) continue;
+            if ((k & 1) && (around[1][dx] == FLOW_UNREACHED || around[dy][1] == FLOW_UNREACHED)) continue;
+            best = around[dy][dx];
+            bestStep = (glm::uint8)k;
+        }
+        direction.tiles[xCode | yCode] = bestStep;
+    }
+}
+
+void FlowField::Follow(RealVec3 target){
+    int x, y;
+    if (!CellOf(target, &x, &y)) return;
+
+    if (!workerRunning) {
+        if (x == targetX && y == targetY) return;
+        Compute(x, y, distance, direction);
+        targetX = requestX = x;
+        targetY = requestY = y;
+        computeCount++;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (hasResult) {
+        std::swap(distance, backDistance);
+        std::swap(direction, backDirection);
+        targetX = resultX;
+        targetY = resultY;
+        hasResult = false;
+        computeCount++;
+        wake.notify_one();
+    }
+    if (x == requestX && y == requestY) return;
+    requestX = x;
+    requestY = y;
+    hasRequest = true;
+    wake.notify_one();
+}
+
+RealVec3 FlowField::Direction(RealVec3 position) const {
+    int x, y;
+    if (!CellOf(position, &x, &y)) return RealVec3(0);
+    int step = direction.At(x, y);
+    return RealVec3(Real(unitX[step]), Real(unitY[step]), 0);
+}
+
+void FlowField::StartWorker(){
+    if (workerRunning) return;
+    workerRunning = true;
+    worker = std::thread(&FlowField::WorkerLoop, this);
+}
+
+void FlowField::StopWorker(){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!workerRunning) return;
+        workerRunning = false;
+    }
+    wake.notify_one();
+    worker.join();
+
+    // Anything still pending is computed on the next Follow.
+    hasRequest = hasResult = false;
+    requestX = targetX;
+    requestY = targetY;
+}
+
+// Computes into the back buffers, then waits for Follow to take the result
+// before starting on the next request.
+void FlowField::WorkerLoop(){
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this]{ return !workerRunning || (hasRequest && !hasResult); });
+        if (!workerRunning) return;
+
+        int x = requestX, y = requestY;
+        hasRequest = false;
+        lock.unlock();
+        Compute(x, y, backDistance, backDirection);
+        lock.lock();
+
+        resultX = x;
+        resultY = y;
+        hasResult = true;
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Fixed.h"
+#include "TileGrid.h"
+
+// Distance of a tile the target cannot be reached from.
+#define FLOW_UNREACHED 0xFFFF
+
+// direction[] value of the target tile and of unreached tiles.
+#define FLOW_NONE 8
+
+// Steering field over a tile grid towards one target cell. A breadth-first
+// search from the target gives every tile its step count, then each tile
+// points at its lowest neighbour (diagonals only when both sides are open).
+// Any number of followers then read their direction in O(1).
+class FlowField {
+public:
+    int width = 0;
+    int height = 0;
+    RealVec3 origin;
+    Real tileSize = 1;
+
+    TileGrid<glm::uint8> blocked;
+
+    // The field the game reads, for the cell in targetX/targetY.
+    TileGrid<glm::uint16> distance;
+    TileGrid<glm::uint8> direction;
+    int targetX = -1;
+    int targetY = -1;
+
+    // Fields computed since Init, for stats.
+    int computeCount = 0;
+
+    // origin is the world position of the bottom left corner of tile (0, 0).
+    void Init(int width, int height, RealVec3 origin, Real tileSize);
+    void Free();
+
+    // Marks every tile the box touches as blocked. Call before StartWorker.
+    void Block(RealVec3 centre, Real width, Real height);
+
+    bool CellOf(RealVec3 position, int *x, int *y) const;
+
+    // Recomputes the field when target is in a different cell than last time.
+    // With the worker running the new field shows up a step or more later, so
+    // keep it off when the simulation has to be deterministic (replays and
+    // rollback).
+    void Follow(RealVec3 target);
+
+    // Unit steering direction at position, zero at the target or when stuck.
+    RealVec3 Direction(RealVec3 position) const;
+
+    void StartWorker();
+    void StopWorker();
+
+private:
+    std::vector<glm::uint32> queue;
+
+    // The worker's side: a request and the buffers it fills.
+    TileGrid<glm::uint16> backDistance;
+    TileGrid<glm::uint8> backDirection;
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool workerRunning = false;
+    bool hasRequest = false;
+    bool hasResult = false;
+    int requestX = -1, requestY = -1;
+    int resultX = -1, resultY = -1;
+
+    void Compute(int x, int y, TileGrid<glm::uint16> &distance, TileGrid<glm::uint8> &direction);
+    void WorkerLoop();
+};
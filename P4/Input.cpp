@@ -0,0 +1,214 @@
+#include "Input.h"
+
+#include <cstring>
+
+#define INPUT_FILE_MAGIC "INP1"
+
+// Step of the record a restart writes; no real step gets this far.
+#define INPUT_RESTART_STEP 0xFFFFFFFF
+
+InputRing::InputRing()
+{
+    head.store(0);
+    tail.store(0);
+}
+
+bool InputRing::Push(const InputEvent &event){
+    Uint32 h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= INPUT_RING_SIZE) return false;
+
+    events[h & (INPUT_RING_SIZE - 1)] = event;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+bool InputRing::Peek(InputEvent *event){
+    Uint32 t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;
+
+    *event = events[t & (INPUT_RING_SIZE - 1)];
+    return true;
+}
+
+void InputRing::Pop(){
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+InputSystem::InputSystem()
+{
+    lastFrame.step = 0;
+    lastFrame.held = 0;
+    lastFrame.pressed = 0;
+    nextReplayFrame = lastFrame;
+}
+
+bool InputSystem::StartRecording(const char *path){
+    Stop();
+    file = fopen(path, "wb");
+    if (file == NULL) return false;
+
+    fwrite(INPUT_FILE_MAGIC, 1, 4, file);
+    mode = INPUT_RECORDING;
+    return true;
+}
+
+bool InputSystem::StartReplay(const char *path){
+    Stop();
+    file = fopen(path, "rb");
+    if (file == NULL) return false;
+
+    char magic[4];
+    if (fread(magic, 1, 4, file) != 4 || memcmp(magic, INPUT_FILE_MAGIC, 4) != 0) {
+        fclose(file);
+        file = NULL;
+        return false;
+    }
+
+    mode = INPUT_REPLAYING;
+    replayFinished = !ReadReplayFrame();
+    return true;
+}
+
+void InputSystem::Stop(){
+    if (file != NULL) {
+        fclose(file);
+        file = NULL;
+    }
+    mode = INPUT_LIVE;
+}
+
+bool InputSystem::PushEvent(const SDL_Event &event){
+    if (event.type != SDL_KEYDOWN && event.type != SDL_KEYUP) return false;
+    if (event.key.repeat) return false;
+
+    InputEvent input;
+    switch (event.key.keysym.sym) {
+        case SDLK_LEFT:
+            input.button = INPUT_LEFT;
+            break;
+        case SDLK_RIGHT:
+            input.button = INPUT_RIGHT;
+            break;
+        case SDLK_SPACE:
+            input.button = INPUT_JUMP;
+            break;
+        default:
+            return false;
+    }
+
+    // While replaying the file is the only source of game input.
+    if (mode == INPUT_REPLAYING) return true;
+
+    input.timestamp = event.key.timestamp;
+    input.down = event.type == SDL_KEYDOWN;
+
+    if (ring.Push(input) == false) droppedEvents++;
+    return true;
+}
+
+// Records are 6 bytes: step (little endian), held, pressed. Only steps whose
+// input differs from the previous step are stored.
+static void WriteFrame(FILE *file, const InputFrame &frame){
+    Uint8 bytes[6] = {
+        (Uint8)(frame.step), (Uint8)(frame.step >> 8), (Uint8)(frame.step >> 16), (Uint8)(frame.step >> 24),
+        frame.held, frame.pressed
+    };
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+bool InputSystem::ReadReplayFrame(){
+    Uint8 bytes[6];
+    if (fread(bytes, 1, sizeof(bytes), file) != sizeof(bytes)) return false;
+
+    nextReplayFrame.step = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((Uint32)bytes[3] << 24);
+    nextReplayFrame.held = bytes[4];
+    nextReplayFrame.pressed = bytes[5];
+    return true;
+}
+
+InputFrame InputSystem::NextFrame(Uint32 stepEndTicks){
+    InputFrame frame;
+    frame.step = step++;
+    frame.held = lastFrame.held;
+    frame.pressed = 0;
+
+    if (mode == INPUT_REPLAYING) {
+        if (!replayFinished && nextReplayFrame.step == frame.step) {
+            frame.held = nextReplayFrame.held;
+            frame.pressed = nextReplayFrame.pressed;
+            replayFinished = !ReadReplayFrame();
+        }
+        lastFrame = frame;
+        return frame;
+    }
+
+    // Only take events that happened before this step ends; later ones wait
+    // in the ring for the step they belong to.
+    InputEvent event;
+    while (ring.Peek(&event)) {
+        if ((Sint32)(event.timestamp - stepEndTicks) > 0) break;
+
+        if (event.down) {
+            held |= INPUT_BIT(event.button);
+            frame.pressed |= INPUT_BIT(event.button);
+        }
+        else {
+            held &= ~INPUT_BIT(event.button);
+        }
+        ring.Pop();
+    }
+    // A tap that starts and ends inside one step still counts as held for it.
+    frame.held = held | frame.pressed;
+
+    if (mode == INPUT_RECORDING && (frame.held != lastFrame.held || frame.pressed != 0)) {
+        WriteFrame(file, frame);
+    }
+
+    lastFrame = frame;
+    return frame;
+}
+
+void InputSystem::Restart(){
+    step = 0;
+    lastFrame.step = 0;
+    lastFrame.held = 0;
+    lastFrame.pressed = 0;
+
+    if (mode == INPUT_RECORDING) {
+        InputFrame mark = lastFrame;
+        mark.step = INPUT_RESTART_STEP;
+        WriteFrame(file, mark);
+    }
+    else if (mode == INPUT_REPLAYING) {
+        // Whatever is left of the last run was never reached; drop it and the mark.
+        while (!replayFinished && nextReplayFrame.step != INPUT_RESTART_STEP) {
+            replayFinished = !ReadReplayFrame();
+        }
+        if (!replayFinished) replayFinished = !ReadReplayFrame();
+    }
+}
+
+void InputSystem::SaveState(InputState &state) const {
+    state.step = step;
+    state.lastFrame = lastFrame;
+    state.nextReplayFrame = nextReplayFrame;
+    state.replayFinished = replayFinished;
+    state.fileOffset = file != NULL ? ftell(file) : 0;
+}
+
+void InputSystem::RestoreState(const InputState &state){
+    step = state.step;
+    lastFrame = state.lastFrame;
+    nextReplayFrame = state.nextReplayFrame;
+    replayFinished = state.replayFinished;
+    if (mode == INPUT_REPLAYING) fseek(file, state.fileOffset, SEEK_SET);
+}
+
+void InputSystem::Flush(){
+    InputEvent event;
+    while (ring.Peek(&event)) {
+        if (event.down) held |= INPUT_BIT(event.button);
+        else held &= ~INPUT_BIT(event.button);
+        ring.Pop();
+    }
+}
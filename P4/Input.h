@@ -0,0 +1,101 @@
+#pragma once
+
+#include <SDL.h>
+#include <atomic>
+#include <cstdio>
+
+// Buttons the game cares about. Keys are mapped to these when they are
+// pushed so the rest of the game never looks at SDL keycodes.
+enum InputButton { INPUT_LEFT, INPUT_RIGHT, INPUT_JUMP, INPUT_BUTTON_COUNT };
+
+#define INPUT_BIT(button) ((Uint8)(1 << (button)))
+
+// One key transition, stamped with the SDL event time in milliseconds.
+struct InputEvent {
+    Uint32 timestamp;
+    Uint8 button;
+    Uint8 down;
+};
+
+// What one fixed simulation step sees: buttons held during the step and
+// buttons that went down since the previous step.
+struct InputFrame {
+    Uint32 step;
+    Uint8 held;
+    Uint8 pressed;
+
+    bool IsHeld(InputButton button) const { return (held & INPUT_BIT(button)) != 0; }
+    bool WasPressed(InputButton button) const { return (pressed & INPUT_BIT(button)) != 0; }
+};
+
+// Single producer / single consumer ring. The producer only writes head,
+// the consumer only writes tail, so no lock is needed.
+#define INPUT_RING_SIZE 256
+
+class InputRing {
+public:
+    InputEvent events[INPUT_RING_SIZE];
+    std::atomic<Uint32> head;
+    std::atomic<Uint32> tail;
+
+    InputRing();
+
+    bool Push(const InputEvent &event);
+    bool Peek(InputEvent *event);
+    void Pop();
+};
+
+enum InputMode { INPUT_LIVE, INPUT_RECORDING, INPUT_REPLAYING };
+
+// Where the input stream is between two steps, so a rollback can put a
+// replay back to the step it restores.
+struct InputState {
+    Uint32 step;
+    InputFrame lastFrame;
+    InputFrame nextReplayFrame;
+    bool replayFinished;
+    long fileOffset;
+};
+
+class InputSystem {
+public:
+    InputRing ring;
+    InputMode mode = INPUT_LIVE;
+
+    Uint8 held = 0;
+    Uint32 step = 0;
+    Uint32 droppedEvents = 0;
+
+    FILE *file = NULL;
+    InputFrame lastFrame;
+    InputFrame nextReplayFrame;
+    bool replayFinished = false;
+
+    InputSystem();
+
+    bool StartRecording(const char *path);
+    bool StartReplay(const char *path);
+    void Stop();
+
+    // Called from the event pump. Returns false if the event is not a game key.
+    bool PushEvent(const SDL_Event &event);
+
+    // Called once per fixed step with the time (ms) the step ends at.
+    InputFrame NextFrame(Uint32 stepEndTicks);
+
+    // Applies queued events to the held state without producing a frame,
+    // used while the simulation is not running.
+    void Flush();
+
+    // Starts counting steps from 0 again, for a restarted world. A recording
+    // marks the restart, and a replay skips to the run after its mark.
+    void Restart();
+
+    // Rewinding only makes sense for a replay: live input cannot be taken
+    // back, and a recording would need its tail cut off.
+    void SaveState(InputState &state) const;
+    void RestoreState(const InputState &state);
+
+private:
+    bool ReadReplayFrame();
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include "ShaderProgram.h"
+#include "glm/vec2.hpp"
+
+// Settings for a continuous stream of particles. rate is in particles per
+// second; angle is the direction they leave in, in radians.
+struct ParticleEmitter {
+    float rate = 200;
+    float speed = 2;
+    float speedSpread = 0.5f;
+    float angle = 0;
+    float angleSpread = 0.3f;
+
+    // Fraction of a particle left over from the last Emit.
+    float pending = 0;
+};
+
+// The live particles oldest first, copied out for a rollback snapshot.
+struct ParticleState {
+    std::vector<float> x, y, vx, vy, age, alpha;
+};
+
+// Fixed-capacity ring of particles in structure-of-arrays layout. Every
+// particle lives for the same time, so the order they are spawned in is the
+// order they die in: the live ones are always the count entries before head,
+// and expiring them only moves the tail. When the ring is full new
+// particles overwrite the oldest.
+//
+// Particles are only drawn, never read back by the simulation.
+class ParticleSystem {
+public:
+    float *x = NULL;
+    float *y = NULL;
+    float *vx = NULL;
+    float *vy = NULL;
+    float *age = NULL;
+    float *alpha = NULL;
+
+    int capacity = 0;
+    int head = 0;
+    int count = 0;
+
+    float lifetime = 0.5f;
+    glm::vec2 gravity = glm::vec2(0);
+    float size = 0.05f;
+
+    void Init(int capacity, float lifetime);
+    void Free();
+    void Clear();
+
+    void Spawn(float x, float y, float vx, float vy);
+
+    void SaveState(ParticleState &state) const;
+    void RestoreState(const ParticleState &state);
+
+    // Spawns emitter.rate * deltaTime particles at position.
+    void Emit(ParticleEmitter &emitter, glm::vec2 position, float deltaTime);
+
+    // Spawns count particles flying out in every direction.
+    void Burst(glm::vec2 position, int count, float speed);
+
+    // Moves and ages every live particle and fades it out over its lifetime.
+    void Update(float deltaTime);
+
+    // One instanced draw; program must use vertex_particle.glsl. The live
+    // particles are streamed into a buffer each call, so a ring that wraps
+    // still goes out contiguous.
+    void Render(ShaderProgram *program);
+
+    // Copies the live particles out oldest first; each array needs count entries.
+    void Copy(float *x, float *y, float *alpha) const;
+
+    // Render for particles copied out of a ring, as the render thread has
+    // them. buffer is the caller's stream buffer, created on first use.
+    static void Draw(ShaderProgram *program, GLuint &buffer, const float *x, const float *y, const float *alpha, int count, float size);
+
+private:
+    GLuint buffer = 0;
+
+    int Tail() const { return (head - count + capacity) % capacity; }
+    void UpdateRange(int begin, int end, float deltaTime);
+    void Upload(const float *field, int offset);
+    void CopyField(const float *field, float *out) const;
+    static void Submit(ShaderProgram *program, int count, float size);
+};
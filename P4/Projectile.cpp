@@ -0,0 +1,204 @@
+#include "Projectile.h"
+
+#include <cmath>
+
+#if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(DETERMINISTIC_MATH)
+#define PROJECTILE_USE_SSE 1
+#endif
+
+#ifdef PROJECTILE_USE_SSE
+// Spreads the low 16 bits of each lane to the even bits.
+static __m128i Spread(__m128i v){
+    v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 8)), _mm_set1_epi32(0x00FF00FF));
+    v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 4)), _mm_set1_epi32(0x0F0F0F0F));
+    v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 2)), _mm_set1_epi32(0x33333333));
+    v = _mm_and_si128(_mm_or_si128(v, _mm_slli_epi32(v, 1)), _mm_set1_epi32(0x55555555));
+    return v;
+}
+
+// TileGrid::Index for four cells at once.
+static __m128i TileIndex(const TileGrid<glm::uint8> &grid, __m128i x, __m128i y){
+    __m128i square = _mm_set1_epi32((1 << grid.squareBits) - 1);
+    __m128i code = _mm_or_si128(Spread(_mm_and_si128(x, square)), _mm_slli_epi32(Spread(_mm_and_si128(y, square)), 1));
+    __m128i high = _mm_srl_epi32(grid.longX ? x : y, _mm_cvtsi32_si128(grid.squareBits));
+    return _mm_or_si128(code, _mm_sll_epi32(high, _mm_cvtsi32_si128(2 * grid.squareBits)));
+}
+#endif
+
+void ProjectileSystem::Init(int capacity){
+    Free();
+    this->capacity = capacity;
+    x = new float[capacity];
+    y = new float[capacity];
+    vx = new float[capacity];
+    vy = new float[capacity];
+    life = new float[capacity];
+    dead.assign(capacity, 0);
+}
+
+void ProjectileSystem::Free(){
+    delete[] x;
+    delete[] y;
+    delete[] vx;
+    delete[] vy;
+    delete[] life;
+    x = y = vx = vy = life = NULL;
+    count = capacity = 0;
+}
+
+void ProjectileSystem::Clear(){
+    count = 0;
+    removedCount = hitCount = 0;
+}
+
+void ProjectileSystem::SaveState(ProjectileState &state) const {
+    state.x.assign(x, x + count);
+    state.y.assign(y, y + count);
+    state.vx.assign(vx, vx + count);
+    state.vy.assign(vy, vy + count);
+    state.life.assign(life, life + count);
+}
+
+void ProjectileSystem::RestoreState(const ProjectileState &state){
+    Clear();
+    for (size_t i = 0; i < state.x.size(); i++) Spawn(state.x[i], state.y[i], state.vx[i], state.vy[i], state.life[i]);
+}
+
+bool ProjectileSystem::Spawn(float x, float y, float vx, float vy, float life){
+    if (count == capacity) return false;
+    this->x[count] = x;
+    this->y[count] = y;
+    this->vx[count] = vx;
+    this->vy[count] = vy;
+    this->life[count] = life;
+    count++;
+    return true;
+}
+
+void ProjectileSystem::Remove(int index){
+    int last = --count;
+    x[index] = x[last];
+    y[index] = y[last];
+    vx[index] = vx[last];
+    vy[index] = vy[last];
+    life[index] = life[last];
+}
+
+bool ProjectileSystem::Update(float deltaTime, const TileGrid<glm::uint8> &tiles, RealVec3 origin, Real tileSize, const Entity *target){
+    float originX = (float)origin.x;
+    float originY = (float)origin.y;
+    float scale = 1.0f / (float)tileSize;
+    float width = (float)tiles.width;
+    float height = (float)tiles.height;
+
+    // A negative reach never hits, which covers having no live target.
+    float targetX = 0, targetY = 0, reachX = -1, reachY = -1;
+    if (target != NULL && target->isActive && target->isDead == false) {
+        targetX = (float)target->position.x;
+        targetY = (float)target->position.y;
+        reachX = (float)target->width / 2.0f + PROJECTILE_SIZE / 2.0f;
+        reachY = (float)target->height / 2.0f + PROJECTILE_SIZE / 2.0f;
+    }
+
+    // Locals, so the stores to dead do not force reloads through tiles.
+    TileGrid<glm::uint8> grid = tiles;
+    unsigned char *gone = &dead[0];
+    int hits = 0;
+    int i = 0;
+#ifdef PROJECTILE_USE_SSE
+    __m128 dt = _mm_set1_ps(deltaTime);
+    __m128 zero = _mm_setzero_ps();
+    __m128 signBit = _mm_set1_ps(-0.0f);
+    __m128 ox = _mm_set1_ps(originX), oy = _mm_set1_ps(originY);
+    __m128 tileScale = _mm_set1_ps(scale);
+    __m128 w = _mm_set1_ps(width), h = _mm_set1_ps(height);
+    __m128 tx = _mm_set1_ps(targetX), ty = _mm_set1_ps(targetY);
+    __m128 rx = _mm_set1_ps(reachX), ry = _mm_set1_ps(reachY);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt));
+        __m128 py = _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt));
+        __m128 left = _mm_sub_ps(_mm_loadu_ps(life + i), dt);
+        _mm_storeu_ps(x + i, px);
+        _mm_storeu_ps(y + i, py);
+        _mm_storeu_ps(life + i, left);
+
+        // Lanes off the grid die anyway, so truncating is as good as floor.
+        __m128 fx = _mm_mul_ps(_mm_sub_ps(px, ox), tileScale);
+        __m128 fy = _mm_mul_ps(_mm_sub_ps(py, oy), tileScale);
+        __m128 off = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(fx, zero), _mm_cmplt_ps(fy, zero)),
+            _mm_or_ps(_mm_cmpge_ps(fx, w), _mm_cmpge_ps(fy, h)));
+        int out = _mm_movemask_ps(_mm_or_ps(off, _mm_cmple_ps(left, zero)));
+
+        __m128 dx = _mm_andnot_ps(signBit, _mm_sub_ps(px, tx));
+        __m128 dy = _mm_andnot_ps(signBit, _mm_sub_ps(py, ty));
+        int hit = _mm_movemask_ps(_mm_and_ps(_mm_cmplt_ps(dx, rx), _mm_cmplt_ps(dy, ry))) & ~out;
+
+        int cell[4];
+        _mm_storeu_si128((__m128i *)cell, TileIndex(grid, _mm_cvttps_epi32(fx), _mm_cvttps_epi32(fy)));
+
+        for (int lane = 0; lane < 4; lane++) {
+            bool kill = ((out | hit) >> lane) & 1;
+            if (!kill) kill = grid.tiles[cell[lane]] != 0;
+            gone[i + lane] = kill;
+            hits += (hit >> lane) & 1;
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+        life[i] -= deltaTime;
+
+        float fx = (x[i] - originX) * scale;
+        float fy = (y[i] - originY) * scale;
+        bool out = life[i] <= 0 || fx < 0 || fy < 0 || fx >= width || fy >= height;
+        bool hit = !out && fabsf(x[i] - targetX) < reachX && fabsf(y[i] - targetY) < reachY;
+
+        gone[i] = out || hit || grid.At((int)fx, (int)fy) != 0;
+        if (hit) hits++;
+    }
+
+    hitCount = hits;
+
+    // Back to front, so the bullet swapped into a hole has been tested already.
+    int before = count;
+    for (int j = count - 1; j >= 0; j--) {
+        if (gone[j]) Remove(j);
+    }
+    removedCount = before - count;
+
+    return hitCount > 0;
+}
+
+void ProjectileSystem::Render(ShaderProgram *program){
+    Draw(program, x, y, count);
+}
+
+void ProjectileSystem::Draw(ShaderProgram *program, const float *x, const float *y, int count){
+    if (count == 0) return;
+
+    float vertices[] = { -0.5, -0.5, 0.5, -0.5, 0.5, 0.5, -0.5, -0.5, 0.5, 0.5, -0.5, 0.5 };
+
+    program->SetModelMatrix(glm::scale(glm::mat3x2(1.0f), glm::vec2(PROJECTILE_SIZE)));
+
+    glVertexAttribPointer(program->positionAttribute, 2, GL_FLOAT, false, 0, vertices);
+    glEnableVertexAttribArray(program->positionAttribute);
+
+    // The x and y arrays are the per-instance data, straight from the pool.
+    glVertexAttribPointer(program->instanceXAttribute, 1, GL_FLOAT, false, 0, x);
+    glEnableVertexAttribArray(program->instanceXAttribute);
+    glVertexAttribDivisor(program->instanceXAttribute, 1);
+
+    glVertexAttribPointer(program->instanceYAttribute, 1, GL_FLOAT, false, 0, y);
+    glEnableVertexAttribArray(program->instanceYAttribute);
+    glVertexAttribDivisor(program->instanceYAttribute, 1);
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+
+    glVertexAttribDivisor(program->instanceXAttribute, 0);
+    glVertexAttribDivisor(program->instanceYAttribute, 0);
+    glDisableVertexAttribArray(program->positionAttribute);
+    glDisableVertexAttribArray(program->instanceXAttribute);
+    glDisableVertexAttribArray(program->instanceYAttribute);
+}
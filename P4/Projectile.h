@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include "Entity.h"
+#include "TileGrid.h"
+
+#define PROJECTILE_CAPACITY 4096
+#define PROJECTILE_SPEED 3.0f
+#define PROJECTILE_LIFE 2.0f
+#define PROJECTILE_SIZE 0.1f
+
+// The live bullets, copied out for a rollback snapshot.
+struct ProjectileState {
+    std::vector<float> x, y, vx, vy, life;
+};
+
+// Bullets kept as structure-of-arrays: one array per field, so the update
+// streams through only the data it needs, four bullets at a time with SSE.
+// Dead bullets are replaced by the last live one, so the arrays stay dense
+// and x and y feed the instanced draw as they are.
+//
+// Bullets are not part of the entity snapshots: Clear them on restart, and
+// keep a SaveState alongside each rollback snapshot.
+class ProjectileSystem {
+public:
+    float *x = NULL;
+    float *y = NULL;
+    float *vx = NULL;
+    float *vy = NULL;
+    float *life = NULL;
+
+    int count = 0;
+    int capacity = 0;
+
+    // Bullets removed by the last Update, and how many of them hit the target.
+    int removedCount = 0;
+    int hitCount = 0;
+
+    void Init(int capacity);
+    void Free();
+    void Clear();
+
+    void SaveState(ProjectileState &state) const;
+    void RestoreState(const ProjectileState &state);
+
+    // Returns false when the pool is full.
+    bool Spawn(float x, float y, float vx, float vy, float life = PROJECTILE_LIFE);
+
+    // Moves every bullet, then removes the ones that ran out of life, left the
+    // grid, entered a non-zero tile or hit target. origin is the world
+    // position of the bottom left corner of tile (0, 0). Returns true when
+    // target was hit.
+    bool Update(float deltaTime, const TileGrid<glm::uint8> &tiles, RealVec3 origin, Real tileSize, const Entity *target);
+
+    // All bullets in one instanced draw; program must use vertex_instanced.glsl.
+    void Render(ShaderProgram *program);
+
+    // Render for bullets copied out of a pool, as the render thread has them.
+    static void Draw(ShaderProgram *program, const float *x, const float *y, int count);
+
+private:
+    std::vector<unsigned char> dead;
+
+    void Remove(int index);
+};
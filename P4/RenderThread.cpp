@@ -0,0 +1,124 @@
+#include "RenderThread.h"
+
+#include <cstring>
+#include "Animation.h"
+#include "Text.h"
+
+// The whole texture; matches Entity::Render's texture coordinates.
+static const UVRect wholeTexture = { 0, 0, 1, 1 };
+
+void RenderFrame::Clear(){
+    sprites.clear();
+    bulletX.clear();
+    bulletY.clear();
+    sparkX.clear();
+    sparkY.clear();
+    sparkAlpha.clear();
+    text.clear();
+}
+
+void RenderFrame::AddSprite(const Entity &entity){
+    if (entity.isActive == false) return;
+
+    SpriteInstance sprite;
+    sprite.modelMatrix = entity.modelMatrix;
+    sprite.textureID = entity.textureID;
+    sprite.rect = entity.animClip >= 0 ? animations.clips[entity.animClip].frames[entity.animFrame] : -1;
+    sprites.push_back(sprite);
+}
+
+void RenderFrame::SetBullets(const ProjectileSystem &projectiles){
+    bulletX.assign(projectiles.x, projectiles.x + projectiles.count);
+    bulletY.assign(projectiles.y, projectiles.y + projectiles.count);
+}
+
+void RenderFrame::SetSparks(const ParticleSystem &sparks){
+    sparkX.resize(sparks.count);
+    sparkY.resize(sparks.count);
+    sparkAlpha.resize(sparks.count);
+    if (sparks.count > 0) sparks.Copy(&sparkX[0], &sparkY[0], &sparkAlpha[0]);
+    sparkSize = sparks.size;
+}
+
+void RenderFrame::AddText(const char *text, float size, float spacing, glm::vec3 position){
+    TextInstance line;
+    strncpy(line.text, text, RENDER_TEXT_LENGTH - 1);
+    line.text[RENDER_TEXT_LENGTH - 1] = '\0';
+    line.size = size;
+    line.spacing = spacing;
+    line.position = position;
+    this->text.push_back(line);
+}
+
+void RenderThread::Publish(){
+    std::lock_guard<std::mutex> lock(mutex);
+    std::swap(back, ready);
+    if (hasFrame) skippedCount++;
+    hasFrame = true;
+    wake.notify_one();
+}
+
+void RenderThread::Start(SDL_Window *window, SDL_GLContext context){
+    if (running) return;
+    this->window = window;
+    this->context = context;
+    running = true;
+    thread = std::thread(&RenderThread::Loop, this);
+}
+
+void RenderThread::Stop(){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!running) return;
+        running = false;
+    }
+    wake.notify_one();
+    thread.join();
+}
+
+void RenderThread::Draw(const RenderFrame &frame){
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    for (size_t i = 0; i < frame.sprites.size(); i++) {
+        const SpriteInstance &sprite = frame.sprites[i];
+        program->SetModelMatrix(sprite.modelMatrix);
+        Entity::DrawSpriteFromTextureAtlas(program, sprite.textureID, sprite.rect >= 0 ? animations.rects[sprite.rect] : wholeTexture);
+    }
+
+    if (frame.bulletX.size() > 0) {
+        ProjectileSystem::Draw(bulletProgram, &frame.bulletX[0], &frame.bulletY[0], (int)frame.bulletX.size());
+    }
+    if (frame.sparkX.size() > 0) {
+        ParticleSystem::Draw(particleProgram, sparkBuffer, &frame.sparkX[0], &frame.sparkY[0], &frame.sparkAlpha[0], (int)frame.sparkX.size(), frame.sparkSize);
+    }
+
+    for (size_t i = 0; i < frame.text.size(); i++) {
+        const TextInstance &line = frame.text[i];
+        DrawText(program, fontTextureID, line.text, line.size, line.spacing, line.position);
+    }
+}
+
+// Draws each new frame as it is published; with nothing new it sleeps
+// rather than redrawing the same picture.
+void RenderThread::Loop(){
+    SDL_GL_MakeCurrent(window, context);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this]{ return !running || hasFrame; });
+        if (!running) break;
+
+        std::swap(front, ready);
+        hasFrame = false;
+        lock.unlock();
+        Draw(frames[front]);
+        SDL_GL_SwapWindow(window);
+        drawnCount++;
+        lock.lock();
+    }
+    lock.unlock();
+
+    if (sparkBuffer != 0) glDeleteBuffers(1, &sparkBuffer);
+    sparkBuffer = 0;
+    SDL_GL_MakeCurrent(window, NULL);
+}
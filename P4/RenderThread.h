@@ -0,0 +1,99 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Entity.h"
+#include "Particles.h"
+#include "Projectile.h"
+
+#define RENDER_TEXT_LENGTH 64
+
+// One entity as drawn: its matrix, texture and atlas rect, or -1 for the
+// whole texture.
+struct SpriteInstance {
+    glm::mat3x2 modelMatrix;
+    GLuint textureID;
+    int rect;
+};
+
+struct TextInstance {
+    char text[RENDER_TEXT_LENGTH];
+    float size;
+    float spacing;
+    glm::vec3 position;
+};
+
+// Everything one frame draws, copied out of the simulation so the renderer
+// never reads live state. Sprites are drawn in the order they were added.
+struct RenderFrame {
+    std::vector<SpriteInstance> sprites;
+    std::vector<float> bulletX, bulletY;
+    std::vector<float> sparkX, sparkY, sparkAlpha;
+    float sparkSize = 0;
+    std::vector<TextInstance> text;
+
+    // Empties the frame but keeps the storage, so refilling it does not allocate.
+    void Clear();
+
+    // Skips inactive entities, as Entity::Render does.
+    void AddSprite(const Entity &entity);
+    void SetBullets(const ProjectileSystem &projectiles);
+    void SetSparks(const ParticleSystem &sparks);
+    void AddText(const char *text, float size, float spacing, glm::vec3 position);
+};
+
+// Draws RenderFrames on a thread of its own, so waiting on the GPU or on
+// vsync in SDL_GL_SwapWindow no longer holds up the simulation.
+//
+// The frames form a triple buffer. The simulation fills Back() and
+// Publishes it, which swaps it with the ready slot and never waits on the
+// renderer. The renderer takes the ready frame when a new one is there and
+// draws it from a third slot, so neither side ever sees a half written
+// frame. Frames published faster than they are drawn are skipped.
+//
+// The thread owns the GL context while it runs: release it on the calling
+// thread before Start, and only touch GL again after Stop. Some platforms
+// (macOS) only swap reliably from the main thread.
+class RenderThread {
+public:
+    ShaderProgram *program = NULL;
+    ShaderProgram *bulletProgram = NULL;
+    ShaderProgram *particleProgram = NULL;
+    GLuint fontTextureID = 0;
+
+    // Frames drawn, and published frames replaced before they were drawn.
+    int drawnCount = 0;
+    int skippedCount = 0;
+
+    // Only the simulation thread touches this frame.
+    RenderFrame &Back() { return frames[back]; }
+    void Publish();
+
+    void Start(SDL_Window *window, SDL_GLContext context);
+
+    // Waits for the frame being drawn, then releases the context.
+    void Stop();
+
+    // Draws frame with the current context, without swapping.
+    void Draw(const RenderFrame &frame);
+
+private:
+    RenderFrame frames[3];
+    int back = 0;
+    int ready = 1;
+    int front = 2;
+    bool hasFrame = false;
+
+    SDL_Window *window = NULL;
+    SDL_GLContext context = NULL;
+    GLuint sparkBuffer = 0;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool running = false;
+
+    void Loop();
+};
@@ -0,0 +1,74 @@
+#include "Scene.h"
+
+#include <algorithm>
+#include <cmath>
+#include "glm/gtc/random.hpp"
+
+#define ROW_SPACING 3
+#define MIN_LEDGE 3
+#define MAX_LEDGE 8
+#define WALL_HEIGHT 2
+
+// A random ledge tile to build on; with no ledges, the origin like the player.
+static RealVec3 RandomBase(const GameState &state, const SceneSpec &spec){
+    if (spec.platformCount == 0) return RealVec3(0);
+    return state.platforms[glm::linearRand(0, spec.platformCount - 1)].position;
+}
+
+int GenerateScene(GameState &state, const SceneSpec &spec){
+    glm::seedRandom(spec.seed);
+
+    int tileCount = spec.platformCount + spec.wallCount;
+    int count = 1 + tileCount + spec.enemyCount;
+    state.entities = new Entity[count];
+    state.player = &state.entities[0];
+    state.platforms = state.player + 1;
+    state.enemies = state.platforms + tileCount;
+
+    // About one tile in four of each row is ledge.
+    int width = std::max(16, (int)std::sqrt((float)spec.platformCount * 4.0f * ROW_SPACING));
+
+    int x = 0, row = 0;
+    for (int i = 0; i < spec.platformCount;) {
+        int length = std::min(glm::linearRand(MIN_LEDGE, MAX_LEDGE), spec.platformCount - i);
+        x += glm::linearRand(1, MAX_LEDGE * 2);
+        if (x + length > width) {
+            x = glm::linearRand(0, MAX_LEDGE);
+            row++;
+        }
+        for (int t = 0; t < length; t++, i++) {
+            Entity &tile = state.platforms[i];
+            tile.entityType = PLATFORM;
+            tile.position = RealVec3(x + t, row * ROW_SPACING, 0);
+            tile.isSleeping = true;
+        }
+        x += length;
+    }
+
+    for (int i = 0; i < spec.wallCount; i++) {
+        Entity &tile = state.platforms[spec.platformCount + i];
+        tile.entityType = PLATFORM;
+        tile.position = RandomBase(state, spec) + RealVec3(0, 1 + i % WALL_HEIGHT, 0);
+        tile.isSleeping = true;
+    }
+
+    for (int i = 0; i < spec.enemyCount; i++) {
+        Entity &enemy = state.enemies[i];
+        enemy.entityType = ENEMY;
+        enemy.aiType = (AIType)(i % AI_TYPE_COUNT);
+        enemy.aiState = WALKING;
+        enemy.position = RandomBase(state, spec) + RealVec3(0, 1, 0);
+        enemy.acceleration = RealVec3(0, -9.81f, 0);
+        enemy.speed = 0.5f;
+    }
+
+    Entity &player = *state.player;
+    player.entityType = PLAYER;
+    player.position = (spec.platformCount > 0 ? state.platforms[0].position : RealVec3(0)) + RealVec3(0, 1, 0);
+    player.acceleration = RealVec3(0, -9.81f, 0);
+    player.speed = 1.5f;
+    player.width = player.height = 0.8f;
+    player.jumpPower = 5.0f;
+
+    return count;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Entity.h"
+
+struct GameState {
+    Entity *entities; // player, platforms and enemies in one block
+    Entity *player;
+    Entity *platforms;
+    Entity *enemies;
+};
+
+// Size of a generated level. P4 has no wall type, so walls are columns of
+// platform tiles and sit in the platform range after the ledges.
+struct SceneSpec {
+    int platformCount = 15;
+    int wallCount = 0;
+    int enemyCount = 3;
+    uint64_t seed = 1;
+};
+
+// Builds a random level of spec's size in the GameState layout: rows of
+// ledges three units apart, wall columns standing on them and enemies of
+// every AIType on top, with the player above the first ledge. The level
+// grows with the square root of the entity count so the density stays
+// about the same. Textures are left at 0. Returns the entity count; free
+// the block with delete[] state.entities.
+int GenerateScene(GameState &state, const SceneSpec &spec);
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <sstream>
 #include "glm/mat4x4.hpp"
+#include "glm/mat3x2.hpp"
 
 class ShaderProgram {
     public:
@@ -17,7 +18,7 @@ class ShaderProgram {
 		void Load(const char *vertexShaderFile, const char *fragmentShaderFile);
 		void Cleanup();
 
-		void SetModelMatrix(const glm::mat4 &matrix);
+		void SetModelMatrix(const glm::mat3x2 &matrix);
         void SetProjectionMatrix(const glm::mat4 &matrix);
         void SetViewMatrix(const glm::mat4 &matrix);
 	
@@ -36,6 +37,11 @@ class ShaderProgram {
         GLuint positionAttribute;
         GLuint texCoordAttribute;
     
+        // Per-instance data, in vertex_instanced.glsl and vertex_particle.glsl only.
+        GLuint instanceXAttribute;
+        GLuint instanceYAttribute;
+        GLuint instanceAlphaAttribute;
+    
         GLuint vertexShader;
         GLuint fragmentShader;
 };
@@ -0,0 +1,44 @@
+#include "Sleep.h"
+
+void SleepSystem::Wake(Entity *entity){
+    if (entity->isSleeping) wakeList.push_back(entity);
+}
+
+void SleepSystem::Flush(){
+    wokenCount = 0;
+    for (size_t i = 0; i < wakeList.size(); i++) {
+        Entity *entity = wakeList[i];
+        if (entity->isSleeping == false) continue;
+        entity->isSleeping = false;
+        entity->restSteps = 0;
+        wokenCount++;
+    }
+    wakeList.clear();
+}
+
+void SleepSystem::Clear(){
+    wakeList.clear();
+    wokenCount = 0;
+}
+
+void SleepSystem::Push(Entity *entity, RealVec3 impulse){
+    entity->velocity += impulse;
+    Wake(entity);
+}
+
+void SleepSystem::WakeContacts(const std::vector<EntityPair> &pairs){
+    for (size_t i = 0; i < pairs.size(); i++) {
+        Entity *a = pairs[i].a;
+        Entity *b = pairs[i].b;
+        if (a->isSleeping == b->isSleeping) continue;
+        Wake(a->isSleeping ? a : b);
+    }
+}
+
+int SleepSystem::CountSleeping(const Entity *entities, int count){
+    int sleeping = 0;
+    for (int i = 0; i < count; i++) {
+        if (entities[i].isSleeping) sleeping++;
+    }
+    return sleeping;
+}
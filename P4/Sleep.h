@@ -0,0 +1,28 @@
+#pragma once
+
+#include <vector>
+#include "Entity.h"
+#include "Broadphase.h"
+
+// Wakes sleeping entities. Anything that drives, pushes or touches one puts
+// it on the wake list, and Flush wakes the whole list at the start of the
+// next step, so the result does not depend on the order the wakes came in.
+class SleepSystem {
+public:
+    std::vector<Entity *> wakeList;
+
+    // Entities woken by the last Flush.
+    int wokenCount = 0;
+
+    void Wake(Entity *entity);
+    void Flush();
+    void Clear();
+
+    // Adds to the entity's velocity and wakes it.
+    void Push(Entity *entity, RealVec3 impulse);
+
+    // Wakes the sleeping side of every pair where only one side sleeps.
+    void WakeContacts(const std::vector<EntityPair> &pairs);
+
+    static int CountSleeping(const Entity *entities, int count);
+};
@@ -0,0 +1,60 @@
+#include "Snapshot.h"
+
+#include <cstring>
+
+void SnapshotRing::Init(void *world, size_t worldSize, int capacity){
+    Free();
+
+    this->world = world;
+    this->worldSize = worldSize;
+    this->capacity = capacity;
+
+    buffer = new unsigned char[worldSize * capacity];
+    steps = new Uint32[capacity];
+}
+
+void SnapshotRing::Free(){
+    delete[] buffer;
+    delete[] steps;
+    buffer = NULL;
+    steps = NULL;
+    Clear();
+}
+
+void SnapshotRing::Save(Uint32 step){
+    memcpy(buffer + head * worldSize, world, worldSize);
+    steps[head] = step;
+    slot = head;
+
+    head = (head + 1) % capacity;
+    if (count < capacity) count++;
+}
+
+bool SnapshotRing::Restore(int age, Uint32 *step){
+    if (age < 0 || age >= count) return false;
+
+    slot = (head - 1 - age + capacity) % capacity;
+    memcpy(world, buffer + slot * worldSize, worldSize);
+    if (step != NULL) *step = steps[slot];
+    return true;
+}
+
+bool SnapshotRing::RestoreAt(Uint32 step, Uint32 *restoredStep){
+    for (int age = 0; age < count; age++) {
+        if (steps[(head - 1 - age + capacity) % capacity] <= step) return Restore(age, restoredStep);
+    }
+    return false;
+}
+
+void SnapshotRing::DropFrom(Uint32 step){
+    while (count > 0 && steps[(head - 1 + capacity) % capacity] >= step) {
+        head = (head - 1 + capacity) % capacity;
+        count--;
+    }
+}
+
+void SnapshotRing::Clear(){
+    head = 0;
+    count = 0;
+    slot = -1;
+}
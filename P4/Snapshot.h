@@ -0,0 +1,41 @@
+#pragma once
+
+#include <SDL.h>
+#include <cstddef>
+
+// Keeps the last N copies of a block of world memory. The world must live in
+// one contiguous allocation (see GameState::entities) so saving and restoring
+// is a single memcpy each way.
+class SnapshotRing {
+public:
+    void *world = NULL;
+    size_t worldSize = 0;
+    int capacity = 0;
+
+    unsigned char *buffer = NULL;
+    Uint32 *steps = NULL;
+
+    int head = 0;
+    int count = 0;
+
+    // Slot the last Save wrote or Restore read, for keeping other per-snapshot
+    // data in arrays of capacity entries alongside the ring.
+    int slot = -1;
+
+    void Init(void *world, size_t worldSize, int capacity);
+    void Free();
+
+    void Save(Uint32 step);
+
+    // age 0 is the most recent snapshot, 1 the one before it, and so on.
+    bool Restore(int age, Uint32 *step);
+
+    // Restores the newest snapshot taken at or before step, for replay seeks.
+    bool RestoreAt(Uint32 step, Uint32 *restoredStep);
+
+    // Forgets every snapshot taken at or after step, so a rewound run saves
+    // them again as it gets there.
+    void DropFrom(Uint32 step);
+
+    void Clear();
+};
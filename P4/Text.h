@@ -0,0 +1,8 @@
+#pragma once
+
+#include <string>
+#include "ShaderProgram.h"
+#include "glm/vec3.hpp"
+
+// Draws text from a 16x16 font atlas, one quad per character, starting at position.
+void DrawText(ShaderProgram *program, GLuint fontTextureID, std::string text, float size, float spacing, glm::vec3 position);
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include "glm/gtc/bitfield.hpp"
+
+// 2D grid of tiles stored in Morton (Z) order, so tiles that are close in x
+// and y are close in memory too. A 3x3 neighbourhood of a row-major grid spans
+// three rows width * sizeof(T) bytes apart; in Z order it usually sits in one
+// or two cache lines. Both sides are padded to powers of two (at most 65536).
+// When they differ, the extra high bits of the longer side go above the
+// interleaved bits, so a 256x16 grid is 16 Z-ordered 16x16 blocks in a row.
+template <typename T>
+class TileGrid {
+public:
+    T *tiles = NULL;
+    int width = 0;
+    int height = 0;
+
+    // Returned by Get and Neighbourhood for coordinates off the grid.
+    T outside = T();
+
+    int squareBits = 0; // log2 of the shorter padded side
+    bool longX = false; // the padded width is the longer side
+    size_t capacity = 0;
+
+    // Morton code bits that belong to x and to y.
+    size_t xMask = 0;
+    size_t yMask = 0;
+
+    void Init(int width, int height, T fill = T()){
+        Free();
+
+        this->width = width;
+        this->height = height;
+
+        int xBits = 0, yBits = 0;
+        while ((1 << xBits) < width) xBits++;
+        while ((1 << yBits) < height) yBits++;
+        longX = xBits > yBits;
+        squareBits = longX ? yBits : xBits;
+        capacity = (size_t)1 << (xBits + yBits);
+
+        size_t low = ((size_t)1 << (2 * squareBits)) - 1;
+        xMask = ((size_t)0x5555555555555555ull & low) | (longX ? ~low : 0);
+        yMask = ((size_t)0xAAAAAAAAAAAAAAAAull & low) | (longX ? 0 : ~low);
+
+        tiles = new T[capacity];
+        for (size_t i = 0; i < capacity; i++) tiles[i] = fill;
+    }
+
+    void Free(){
+        delete[] tiles;
+        tiles = NULL;
+        width = height = 0;
+        capacity = 0;
+    }
+
+    size_t Index(int x, int y) const {
+        int square = (1 << squareBits) - 1;
+        size_t code = glm::bitfieldInterleave((glm::uint16)(x & square), (glm::uint16)(y & square));
+        return code | ((size_t)((longX ? x : y) >> squareBits) << (2 * squareBits));
+    }
+
+    // Index(x, y) == XCode(x) | YCode(y). Walking a row or column steps one of
+    // the two with NextX/NextY instead of re-encoding: the bits of the other
+    // axis are set so the carry of the +1 skips over them. PrevX/PrevY borrow
+    // through the clear bits the same way.
+    size_t XCode(int x) const { return Index(x, 0); }
+    size_t YCode(int y) const { return Index(0, y); }
+    size_t NextX(size_t xCode) const { return ((xCode | ~xMask) + 1) & xMask; }
+    size_t NextY(size_t yCode) const { return ((yCode | ~yMask) + 1) & yMask; }
+    size_t PrevX(size_t xCode) const { return (xCode - 1) & xMask; }
+    size_t PrevY(size_t yCode) const { return (yCode - 1) & yMask; }
+
+    bool Contains(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+
+    T &At(int x, int y) { return tiles[Index(x, y)]; }
+    const T &At(int x, int y) const { return tiles[Index(x, y)]; }
+    T Get(int x, int y) const { return Contains(x, y) ? tiles[Index(x, y)] : outside; }
+    void Set(int x, int y, T value){ if (Contains(x, y)) tiles[Index(x, y)] = value; }
+
+    // Calls fn(x, y, tile) for every tile in [x0, x1) x [y0, y1), clipped to the grid.
+    template <typename F>
+    void ForEachInRect(int x0, int y0, int x1, int y1, F fn){
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > width) x1 = width;
+        if (y1 > height) y1 = height;
+        if (x0 >= x1 || y0 >= y1) return;
+
+        size_t first = XCode(x0);
+        size_t yCode = YCode(y0);
+        for (int y = y0; y < y1; y++, yCode = NextY(yCode)) {
+            size_t xCode = first;
+            for (int x = x0; x < x1; x++, xCode = NextX(xCode)) fn(x, y, tiles[xCode | yCode]);
+        }
+    }
+
+    // Copies the (2 * radius + 1)^2 tiles centred on (x, y) into out, row by row.
+    // Tiles off the grid read as outside.
+    void Neighbourhood(int x, int y, int radius, T *out) const {
+        int side = 2 * radius + 1;
+        int x0 = x - radius, y0 = y - radius;
+        bool inside = x0 >= 0 && y0 >= 0 && x0 + side <= width && y0 + side <= height;
+        if (!inside) {
+            for (int dy = 0; dy < side; dy++)
+                for (int dx = 0; dx < side; dx++) out[dy * side + dx] = Get(x0 + dx, y0 + dy);
+            return;
+        }
+
+        size_t first = XCode(x0);
+        size_t yCode = YCode(y0);
+        for (int dy = 0; dy < side; dy++, yCode = NextY(yCode)) {
+            size_t xCode = first;
+            for (int dx = 0; dx < side; dx++, xCode = NextX(xCode)) out[dy * side + dx] = tiles[xCode | yCode];
+        }
+    }
+};
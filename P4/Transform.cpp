@@ -0,0 +1,76 @@
+#include "Transform.h"
+
+#include <algorithm>
+
+void TransformSystem::Build(Entity *entities, int count){
+    this->count = count;
+
+    std::vector<int> depth(count);
+    for (int i = 0; i < count; i++) {
+        int d = 0;
+        for (int p = entities[i].parent; p >= 0; p = entities[p].parent) d++;
+        depth[i] = d;
+    }
+
+    order.resize(count);
+    for (int i = 0; i < count; i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&depth](int a, int b) { return depth[a] < depth[b]; });
+
+    std::vector<int> slot(count);
+    for (int s = 0; s < count; s++) slot[order[s]] = s;
+
+    parentSlot.resize(count);
+    for (int s = 0; s < count; s++) {
+        int p = entities[order[s]].parent;
+        parentSlot[s] = p >= 0 ? slot[p] : -1;
+    }
+    changed.assign(count, 0);
+}
+
+bool TransformSystem::Attach(Entity *entities, int child, int parent){
+    for (int p = parent; p >= 0; p = entities[p].parent) {
+        if (p == child) return false;
+    }
+
+    Entity &entity = entities[child];
+    entity.position = WorldPosition(entities, child);
+    entity.localPosition = entity.position - WorldPosition(entities, parent);
+    entity.parent = parent;
+    entity.transformDirty = true;
+    Build(entities, count);
+    return true;
+}
+
+void TransformSystem::Detach(Entity *entities, int child){
+    Entity &entity = entities[child];
+    if (entity.parent < 0) return;
+
+    entity.position = WorldPosition(entities, child);
+    entity.localPosition = RealVec3(0);
+    entity.parent = -1;
+    entity.transformDirty = true;
+    Build(entities, count);
+}
+
+void TransformSystem::Update(Entity *entities){
+    updatedCount = 0;
+    for (int s = 0; s < count; s++) {
+        Entity &entity = entities[order[s]];
+        int p = parentSlot[s];
+        bool dirty = entity.transformDirty || (p >= 0 && changed[p]);
+        changed[s] = dirty;
+        if (dirty == false) continue;
+
+        // Parents come first, so the parent's position is already current.
+        if (p >= 0) entity.position = entities[order[p]].position + entity.localPosition;
+        entity.modelMatrix = glm::translate(glm::mat3x2(1.0f), glm::vec2(glm::vec3(entity.position)));
+        entity.transformDirty = false;
+        updatedCount++;
+    }
+}
+
+RealVec3 TransformSystem::WorldPosition(const Entity *entities, int index){
+    const Entity &entity = entities[index];
+    if (entity.parent < 0) return entity.position;
+    return WorldPosition(entities, entity.parent) + entity.localPosition;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+#include "Entity.h"
+
+// World matrices for an entity array with parent links. The entities are
+// kept in a flat list where every parent comes before its children, and
+// Update walks it once: an entity's matrix is rebuilt only when it is
+// transformDirty or its parent's was rebuilt earlier in the same pass, so
+// entities that never move cost one flag test.
+//
+// position stays in world space for collisions and everything else that
+// reads it. An entity with a parent is placed by its localPosition instead,
+// and Update writes its position from the parent's, so a moved parent
+// carries its children along on the next Update. The links and flags live
+// in the Entity, so snapshots carry them; call Build after restoring one.
+class TransformSystem {
+public:
+    // Matrices rebuilt by the last Update.
+    int updatedCount = 0;
+
+    void Build(Entity *entities, int count);
+
+    // Parents child to parent without moving it in the world; its
+    // localPosition becomes the current offset. Fails when parent is child or
+    // one of its descendants.
+    bool Attach(Entity *entities, int child, int parent);
+    void Detach(Entity *entities, int child);
+
+    void Update(Entity *entities);
+
+    // Where index is once its parents' moves are applied, without waiting for Update.
+    static RealVec3 WorldPosition(const Entity *entities, int index);
+
+private:
+    // order[s] is the entity in slot s, parentSlot[s] its parent's slot or
+    // -1, and changed[s] whether the current pass rebuilt it.
+    std::vector<int> order;
+    std::vector<int> parentSlot;
+    std::vector<unsigned char> changed;
+
+    int count = 0;
+};
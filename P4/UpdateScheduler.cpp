@@ -0,0 +1,99 @@
+#include "UpdateScheduler.h"
+
+#include <chrono>
+#include "glm/common.hpp"
+
+static double Now(){
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void UpdateScheduler::SetView(glm::vec2 viewMin, glm::vec2 viewMax){
+    this->viewMin = viewMin;
+    this->viewMax = viewMax;
+}
+
+int UpdateScheduler::Classify(const Entity &entity) const {
+    if (entity.entityType == PLAYER) return 0;
+
+    glm::vec2 position = glm::vec2(glm::vec3(entity.position));
+    glm::vec2 outside = glm::max(glm::max(viewMin - position, position - viewMax), glm::vec2(0));
+    float distance = glm::max(outside.x, outside.y);
+
+    int tier = 0;
+    while (tier + 1 < UPDATE_TIER_COUNT && distance >= range[tier + 1]) tier++;
+    return tier;
+}
+
+void UpdateScheduler::File(int index, int tier){
+    std::vector<int> &list = lists[tier][index % period[tier]];
+    slot[index] = (int)list.size();
+    list.push_back(index);
+    tierCount[tier]++;
+}
+
+void UpdateScheduler::Unfile(int index, int tier){
+    std::vector<int> &list = lists[tier][index % period[tier]];
+    int last = list.back();
+    list[slot[index]] = last;
+    slot[last] = slot[index];
+    list.pop_back();
+    tierCount[tier]--;
+}
+
+void UpdateScheduler::Rebuild(Entity *entities, int count, unsigned int step){
+    for (int t = 0; t < UPDATE_TIER_COUNT; t++) {
+        lists[t].assign(period[t], std::vector<int>());
+        tierCount[t] = 0;
+    }
+    slot.resize(count);
+    due.clear();
+
+    for (int i = 0; i < count; i++) {
+        Entity &entity = entities[i];
+        entity.updateDue = false;
+
+        // Begin runs every entity at least once per period of its tier.
+        unsigned int oldest = step >= (unsigned int)period[entity.updateTier] ? step - period[entity.updateTier] + 1 : 0;
+        if (entity.updateStep < oldest || entity.updateStep > step) entity.updateStep = step;
+        File(i, entities[i].updateTier);
+    }
+}
+
+void UpdateScheduler::Begin(Entity *entities, unsigned int step, float deltaTime){
+    for (size_t i = 0; i < due.size(); i++) entities[due[i]].updateDue = false;
+    due.clear();
+
+    // Entity i of tier t is due when (step + i) % period[t] == 0.
+    for (int t = 0; t < UPDATE_TIER_COUNT; t++) {
+        const std::vector<int> &list = lists[t][(period[t] - step % period[t]) % period[t]];
+        due.insert(due.end(), list.begin(), list.end());
+    }
+
+    int count = (int)slot.size();
+    skippedCount = count - (int)due.size();
+
+    for (size_t i = 0; i < due.size(); i++) {
+        int index = due[i];
+        Entity &entity = entities[index];
+        entity.updateDue = true;
+        entity.updateTime = (step + 1 - entity.updateStep) * deltaTime;
+        entity.updateStep = step + 1;
+
+        int tier = Classify(entity);
+        if (tier == entity.updateTier) continue;
+        Unfile(index, entity.updateTier);
+        File(index, tier);
+        entity.updateTier = tier;
+    }
+
+    beginTime = Now();
+}
+
+void UpdateScheduler::End(){
+    double elapsed = Now() - beginTime;
+    if (due.size() > 0) {
+        double cost = elapsed / due.size();
+        updateCost = updateCost == 0 ? cost : updateCost * 0.9 + cost * 0.1;
+    }
+    savedTime = updateCost * skippedCount;
+}
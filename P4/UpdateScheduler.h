@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+#include "Entity.h"
+#include "glm/vec2.hpp"
+
+#define UPDATE_TIER_COUNT 4
+
+// Update-rate LOD. Each entity gets a tier from its distance outside the
+// view, and tier t only runs every period[t] steps with the time it missed.
+// A tier's entities are filed by index modulo its period, so each step runs
+// an even share of them instead of all far entities at once, and a step
+// only touches the entities that are due. The player always stays in tier 0.
+//
+// The tier and the last simulated step live in the Entity, so snapshots
+// carry the schedule; call Rebuild after restoring one.
+class UpdateScheduler {
+public:
+    int period[UPDATE_TIER_COUNT] = { 1, 2, 4, 8 };
+
+    // Distance outside the view at which each tier starts.
+    float range[UPDATE_TIER_COUNT] = { 0, 2, 8, 24 };
+
+    glm::vec2 viewMin = glm::vec2(0);
+    glm::vec2 viewMax = glm::vec2(0);
+
+    // Indices of the entities due this step, from Begin to the next Begin.
+    std::vector<int> due;
+
+    int tierCount[UPDATE_TIER_COUNT];
+    int skippedCount = 0;
+
+    // Smoothed cost of one entity update in microseconds, measured between
+    // Begin and End, and the time the skipped updates would have taken. Work
+    // in between that runs for every entity anyway is counted as update
+    // cost, so savedTime reads high when there is a lot of it.
+    double updateCost = 0;
+    double savedTime = 0;
+
+    void SetView(glm::vec2 viewMin, glm::vec2 viewMax);
+
+    // Files every entity under its updateTier. Call once the entity array is
+    // set up and after restoring a snapshot of it. step is the next step
+    // Begin will see. A snapshot from that step keeps its schedule as it is;
+    // an entity whose updateStep could not come from that step (a restart
+    // after the step count moved on) counts as simulated up to it, so it
+    // does not catch up on time from before the snapshot.
+    void Rebuild(Entity *entities, int count, unsigned int step);
+
+    // Marks the entities due at step, hands them the time they have to catch
+    // up on and moves them to the tier they are in now.
+    void Begin(Entity *entities, unsigned int step, float deltaTime);
+    void End();
+
+private:
+    // lists[t][p] holds the tier t entities with index % period[t] == p;
+    // slot[i] is entity i's place in its list.
+    std::vector<std::vector<int> > lists[UPDATE_TIER_COUNT];
+    std::vector<int> slot;
+
+    double beginTime = 0;
+
+    int Classify(const Entity &entity) const;
+    void File(int index, int tier);
+    void Unfile(int index, int tier);
+};
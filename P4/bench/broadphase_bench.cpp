@@ -0,0 +1,123 @@
+// Sweep-and-prune (Broadphase.h) against testing every pair, for 10 to 100k
+// moving entities at a fixed density. The world grows with the count so each
+// entity has about the same number of neighbours at every size.
+// Entity.cpp brings in the GL code, so link it like the game:
+//   g++ -O2 -std=c++11 -I.. $(sdl2-config --cflags) broadphase_bench.cpp ../Broadphase.cpp ../Entity.cpp
+//       ../Animation.cpp ../ShaderProgram.cpp $(sdl2-config --libs) -lGL -o broadphase_bench
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "Broadphase.h"
+
+#define DENSITY 0.05f
+#define MAX_SPEED 3.0f
+#define STEP_TIME 0.0166666f
+#define STEP_COUNT 100
+#define BRUTE_FORCE_BUDGET 200000000.0
+#define CHECK_LIMIT 10000
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct World {
+    std::vector<Entity> entities;
+    float side;
+
+    World(int count) : entities(count), side(std::sqrt(count / DENSITY)) {
+        for (int i = 0; i < count; i++) {
+            Entity &entity = entities[i];
+            entity.position = RealVec3(glm::linearRand(0.0f, side), glm::linearRand(0.0f, side), 0);
+            entity.velocity = RealVec3(glm::circularRand(MAX_SPEED), 0);
+            entity.width = glm::linearRand(0.5f, 1.0f);
+            entity.height = glm::linearRand(0.5f, 1.0f);
+        }
+    }
+
+    void Step(){
+        for (size_t i = 0; i < entities.size(); i++) {
+            Entity &entity = entities[i];
+            entity.position += entity.velocity * STEP_TIME;
+            if (entity.position.x < 0 || entity.position.x > side) entity.velocity.x = -entity.velocity.x;
+            if (entity.position.y < 0 || entity.position.y > side) entity.velocity.y = -entity.velocity.y;
+        }
+    }
+};
+
+// Same test as Entity::CheckCollision.
+static bool Overlaps(const Entity &a, const Entity &b){
+    Real xdist = fabs(a.position.x - b.position.x) - ((a.width + b.width) / 2.0f);
+    Real ydist = fabs(a.position.y - b.position.y) - ((a.height + b.height) / 2.0f);
+    return xdist < 0 && ydist < 0;
+}
+
+static void BruteForce(const World &world, std::vector<std::pair<int, int> > &pairs){
+    pairs.clear();
+    int count = (int)world.entities.size();
+    for (int i = 0; i < count; i++)
+        for (int j = i + 1; j < count; j++)
+            if (Overlaps(world.entities[i], world.entities[j])) pairs.push_back(std::make_pair(i, j));
+}
+
+static void Collect(const World &world, const SweepAndPrune &broadphase, std::vector<std::pair<int, int> > &pairs){
+    pairs.clear();
+    for (size_t i = 0; i < broadphase.pairs.size(); i++) {
+        int a = (int)(broadphase.pairs[i].a - &world.entities[0]);
+        int b = (int)(broadphase.pairs[i].b - &world.entities[0]);
+        pairs.push_back(std::make_pair(std::min(a, b), std::max(a, b)));
+    }
+    std::sort(pairs.begin(), pairs.end());
+}
+
+int main(){
+    printf("%8s %12s %12s %10s %14s %9s %s\n", "entities", "sap us/step", "swaps/step", "pairs", "brute us/step", "speedup", "mismatches");
+
+    const int counts[] = { 10, 100, 1000, 10000, 100000 };
+    for (int c = 0; c < (int)(sizeof(counts) / sizeof(counts[0])); c++) {
+        int count = counts[c];
+        World world(count);
+
+        SweepAndPrune broadphase;
+        for (int i = 0; i < count; i++) broadphase.Add(&world.entities[i]);
+        broadphase.Update();
+
+        // The pairs must match every step, not only after the first full sort.
+        // Past CHECK_LIMIT the brute force is too slow to run more than once.
+        std::vector<std::pair<int, int> > expected, found;
+        int mismatches = 0;
+        for (int s = 0; s < (count <= CHECK_LIMIT ? 3 : 1); s++) {
+            world.Step();
+            broadphase.Update();
+            BruteForce(world, expected);
+            Collect(world, broadphase, found);
+            if (expected != found) mismatches++;
+        }
+
+        double swaps = 0, pairs = 0;
+        Clock::time_point start = Clock::now();
+        for (int s = 0; s < STEP_COUNT; s++) {
+            world.Step();
+            broadphase.Update();
+            swaps += broadphase.swapCount;
+            pairs += broadphase.pairs.size();
+        }
+        double sapTime = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / STEP_COUNT;
+
+        int bruteSteps = (int)std::max(1.0, BRUTE_FORCE_BUDGET / ((double)count * count / 2));
+        if (bruteSteps > STEP_COUNT) bruteSteps = STEP_COUNT;
+        start = Clock::now();
+        for (int s = 0; s < bruteSteps; s++) {
+            world.Step();
+            BruteForce(world, expected);
+        }
+        double bruteTime = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / bruteSteps;
+
+        printf("%8d %12.1f %12.1f %10.1f %14.1f %8.1fx %d\n", count, sapTime, swaps / STEP_COUNT, pairs / STEP_COUNT,
+            bruteTime, bruteTime / sapTime, mismatches);
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Per-step cost of Entity::Update on a crowd of player and enemy bodies
+// walking a floor with ledges, in the math this build selects: float by
+// default, fixed with -DDETERMINISTIC_MATH. Every body follows a scripted
+// input, so the run is a replay; its final state hash is printed, and
+// fixed_replay.sh checks that -O0 and -O2 builds end on the same one.
+// Players get no enemy list, as in main.cpp, where stomping is resolved
+// from the broadphase pairs.
+// Entity.cpp brings in the GL code, so link it like the game:
+//   g++ -O2 -std=c++11 -DDETERMINISTIC_MATH -I.. $(sdl2-config --cflags) fixed_bench.cpp
+//       ../Entity.cpp ../Animation.cpp ../ShaderProgram.cpp $(sdl2-config --libs) -lGL
+//   fixed_bench [--hash]
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "Entity.h"
+
+#define FLOOR_COUNT 160
+#define LEDGE_COUNT 40
+#define TILE_COUNT (FLOOR_COUNT + LEDGE_COUNT)
+#define PLAYER_COUNT 250
+#define ENEMY_COUNT 250
+#define STEP_COUNT 600
+#define STEP_TIME 0.0166666f
+
+#ifdef DETERMINISTIC_MATH
+#define MATH_NAME "fixed"
+#else
+#define MATH_NAME "float"
+#endif
+
+static uint32_t Hash(uint32_t hash, const void *data, size_t size){
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) hash = (hash ^ bytes[i]) * 16777619u;
+    return hash;
+}
+
+// A floor with a row of short ledges above it, and the bodies spread along it.
+static void Build(Entity *tiles, Entity *players, Entity *enemies){
+    for (int i = 0; i < FLOOR_COUNT; i++) {
+        tiles[i].entityType = PLATFORM;
+        tiles[i].position = RealVec3(i - FLOOR_COUNT / 2, -3.25f, 0);
+    }
+    for (int i = 0; i < LEDGE_COUNT; i++) {
+        tiles[FLOOR_COUNT + i].entityType = PLATFORM;
+        tiles[FLOOR_COUNT + i].position = RealVec3((i / 4) * 12 + i % 4 - FLOOR_COUNT / 2, -1.25f, 0);
+    }
+
+    for (int i = 0; i < PLAYER_COUNT; i++) {
+        Entity &player = players[i];
+        player.entityType = PLAYER;
+        player.position = RealVec3((i % 140) - 70 + 0.5f, -2.0f + (i % 3), 0);
+        player.acceleration = RealVec3(0, -9.81f, 0);
+        player.speed = 1.5f;
+        player.width = player.height = 0.8f;
+        player.jumpPower = 5.0f;
+    }
+    for (int i = 0; i < ENEMY_COUNT; i++) {
+        Entity &enemy = enemies[i];
+        enemy.entityType = ENEMY;
+        enemy.position = RealVec3((i % 140) - 70 + 0.25f, -2.0f, 0);
+        enemy.acceleration = RealVec3(0, -9.81f, 0);
+        enemy.speed = 0.5f;
+    }
+}
+
+// The scripted input: each body turns every couple of seconds, and players
+// jump now and then from the ground.
+static void ApplyInput(Entity *bodies, int count, int step){
+    for (int i = 0; i < count; i++) {
+        Entity &body = bodies[i];
+        body.movement = RealVec3((float)((step / 120 + i) % 3 - 1), 0, 0);
+        if (body.entityType == PLAYER && body.collidedBottom && (step + i * 7) % 90 == 0) body.jump = true;
+    }
+}
+
+int main(int argc, char **argv){
+    bool hashOnly = argc > 1 && strcmp(argv[1], "--hash") == 0;
+
+    Entity *entities = new Entity[TILE_COUNT + PLAYER_COUNT + ENEMY_COUNT];
+    Entity *tiles = entities;
+    Entity *players = tiles + TILE_COUNT;
+    Entity *enemies = players + PLAYER_COUNT;
+    Build(tiles, players, enemies);
+
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (int step = 0; step < STEP_COUNT; step++) {
+        ApplyInput(players, PLAYER_COUNT + ENEMY_COUNT, step);
+        for (int i = 0; i < PLAYER_COUNT; i++) players[i].Update(STEP_TIME, tiles, TILE_COUNT, NULL, 0);
+        for (int i = 0; i < ENEMY_COUNT; i++) enemies[i].Update(STEP_TIME, tiles, TILE_COUNT, enemies, ENEMY_COUNT);
+    }
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < PLAYER_COUNT + ENEMY_COUNT; i++) {
+        hash = Hash(hash, &players[i].position, sizeof(RealVec3));
+        hash = Hash(hash, &players[i].velocity, sizeof(RealVec3));
+        hash = Hash(hash, &players[i].isActive, sizeof(bool));
+    }
+
+    if (hashOnly) {
+        printf("%08x\n", hash);
+    }
+    else {
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        printf("%s %8.3f ns/body-step  hash %08x\n", MATH_NAME, ns / ((double)(PLAYER_COUNT + ENEMY_COUNT) * STEP_COUNT), hash);
+    }
+
+    delete[] entities;
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/bin/sh
+# Replay test for DETERMINISTIC_MATH: builds fixed_bench at -O0 and -O2 and
+# fails unless both end the scripted run on the same state hash. Extra
+# arguments go to both compiles, e.g. -ffast-math or include paths.
+#   sh fixed_replay.sh [compiler flags]
+
+cd "$(dirname "$0")" || exit 1
+SOURCES="fixed_bench.cpp ../Entity.cpp ../Animation.cpp ../ShaderProgram.cpp"
+FLAGS="-std=c++11 -DDETERMINISTIC_MATH -I.. $(sdl2-config --cflags) $*"
+LIBS="$(sdl2-config --libs) -lGL"
+
+for level in 0 2; do
+    g++ -O$level $FLAGS $SOURCES $LIBS -o fixed_replay_O$level || exit 1
+done
+
+O0=$(./fixed_replay_O0 --hash)
+O2=$(./fixed_replay_O2 --hash)
+rm -f fixed_replay_O0 fixed_replay_O2
+
+if [ "$O0" != "$O2" ]; then
+    echo "FAIL: -O0 hash $O0, -O2 hash $O2"
+    exit 1
+fi
+echo "OK: -O0 and -O2 both end on $O0"
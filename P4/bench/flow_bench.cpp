@@ -0,0 +1,107 @@
+// Flow-field (FlowField.h) build and lookup cost on a large random map, a
+// check that following the field reaches the target, and how long Follow
+// blocks the caller with and without the worker thread.
+//   g++ -O2 -std=c++11 -pthread -I.. flow_bench.cpp ../FlowField.cpp
+//   g++ -O2 -std=c++11 -pthread -DGLM_FORCE_AVX2 -mavx2 -mbmi2 -I.. flow_bench.cpp ../FlowField.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "FlowField.h"
+
+#define MAP_SIZE 256
+#define WALL_CHANCE 0.25f
+#define ENEMY_COUNT 100000
+#define FIELD_COUNT 50
+#define WALK_COUNT 2000
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static double Since(Clock::time_point start){
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static RealVec3 Centre(int x, int y){
+    return RealVec3(x + 0.5f, y + 0.5f, 0);
+}
+
+int main(){
+    FlowField field;
+    field.Init(MAP_SIZE, MAP_SIZE, RealVec3(0), 1);
+    for (int y = 0; y < MAP_SIZE; y++)
+        for (int x = 0; x < MAP_SIZE; x++)
+            if (glm::linearRand(0.0f, 1.0f) < WALL_CHANCE) field.Block(Centre(x, y), 1, 1);
+
+    std::vector<glm::ivec2> targets(FIELD_COUNT);
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        do targets[i] = glm::ivec2(glm::linearRand(0, MAP_SIZE - 1), glm::linearRand(0, MAP_SIZE - 1));
+        while (field.blocked.At(targets[i].x, targets[i].y));
+    }
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < FIELD_COUNT; i++) field.Follow(Centre(targets[i].x, targets[i].y));
+    double build = Since(start) / FIELD_COUNT;
+    printf("%dx%d map, %d%% walls\n", MAP_SIZE, MAP_SIZE, (int)(WALL_CHANCE * 100));
+    printf("field build                %9.1f us\n", build);
+
+    start = Clock::now();
+    for (int i = 0; i < 100; i++) field.Follow(Centre(targets.back().x, targets.back().y));
+    printf("Follow, same cell          %9.3f us\n", Since(start) / 100);
+
+    // Following the arrows from any reached tile must end on the target,
+    // never through a wall, in at most distance steps.
+    int failures = 0, walks = 0;
+    for (int i = 0; i < WALK_COUNT; i++) {
+        int x = glm::linearRand(0, MAP_SIZE - 1), y = glm::linearRand(0, MAP_SIZE - 1);
+        int limit = field.distance.At(x, y);
+        if (limit == FLOW_UNREACHED) continue;
+        walks++;
+        int steps = 0;
+        while (steps <= limit && (x != field.targetX || y != field.targetY)) {
+            glm::vec3 d = field.Direction(Centre(x, y));
+            x += (d.x > 0) - (d.x < 0);
+            y += (d.y > 0) - (d.y < 0);
+            if (!field.blocked.Contains(x, y) || field.blocked.At(x, y)) break;
+            steps++;
+        }
+        if (x != field.targetX || y != field.targetY) failures++;
+    }
+    printf("walks to the target        %9d, failures %d\n", walks, failures);
+
+    std::vector<RealVec3> enemies(ENEMY_COUNT), steering(ENEMY_COUNT);
+    for (int i = 0; i < ENEMY_COUNT; i++) enemies[i] = RealVec3(glm::linearRand(0.0f, (float)MAP_SIZE), glm::linearRand(0.0f, (float)MAP_SIZE), 0);
+    start = Clock::now();
+    for (int r = 0; r < 10; r++)
+        for (int i = 0; i < ENEMY_COUNT; i++) steering[i] = field.Direction(enemies[i]);
+    double lookup = Since(start) * 1000.0 / (10.0 * ENEMY_COUNT);
+    printf("Direction per enemy        %9.1f ns\n", lookup);
+    printf("%d enemies: field + lookups %.2f ms, one search per enemy ~%.0f ms\n",
+        ENEMY_COUNT, (build + lookup * ENEMY_COUNT / 1000.0) / 1000.0, build * ENEMY_COUNT / 1000.0);
+
+    // The worker moves the build off the caller; the field arrives later.
+    field.StartWorker();
+    double blocked = 0;
+    int polls = 0;
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        RealVec3 target = Centre(targets[i].x, targets[i].y);
+        start = Clock::now();
+        field.Follow(target);
+        blocked += Since(start);
+        while (field.targetX != targets[i].x || field.targetY != targets[i].y) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            start = Clock::now();
+            field.Follow(target);
+            blocked += Since(start);
+            polls++;
+        }
+    }
+    field.StopWorker();
+    printf("Follow with worker         %9.3f us per call, %.1f polls until the field lands\n",
+        blocked / (FIELD_COUNT + polls), (double)polls / FIELD_COUNT);
+
+    field.Free();
+    return 0;
+}
@@ -0,0 +1,233 @@
+// Microbenchmarks for the glm hot paths the games use: mat4 multiply, inverse,
+// translate/rotate, normalize, quaternion ops and noise. The SIMD code in glm is
+// chosen at compile time, so build once per ISA and compare the runs:
+//   g++ -O2 -std=c++11 -I.. glm_bench.cpp -o glm_bench_scalar
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -DGLM_FORCE_ALIGNED_GENTYPES -I.. glm_bench.cpp -o glm_bench_sse2
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE42 -DGLM_FORCE_ALIGNED_GENTYPES -msse4.2 -I.. glm_bench.cpp -o glm_bench_sse4
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -DGLM_FORCE_ALIGNED_GENTYPES -mavx2 -mfma -I.. glm_bench.cpp -o glm_bench_avx2
+// GLM_FORCE_INTRINSICS with -march=native picks the ISA from the compiler flags instead.
+//
+// Rows tagged "default" use the packed types the games use (glm::mat4, ...); glm
+// only runs its SIMD kernels on the aligned types, which get their own rows.
+// --json prints one JSON object per run, so several builds can be collected with
+//   for b in ./glm_bench_*; do $b --json; done > glm_bench.json
+// The checksum of each row should agree between builds to a few ULP.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/noise.hpp"
+#include "glm/gtc/quaternion.hpp"
+#include "glm/gtc/random.hpp"
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#include "glm/gtc/type_aligned.hpp"
+#endif
+
+#define ITEM_COUNT 1024
+#define TRIAL_SECONDS 0.02
+#define TRIAL_COUNT 5
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Result {
+    const char *name;
+    const char *type;
+    double ns;
+    double checksum;
+};
+
+static std::vector<Result> results;
+
+template <glm::length_t L, typename T, glm::qualifier Q>
+static double Sum(const glm::vec<L, T, Q> &v){
+    double s = 0;
+    for (glm::length_t i = 0; i < L; i++) s += v[i];
+    return s;
+}
+
+template <glm::length_t C, glm::length_t R, typename T, glm::qualifier Q>
+static double Sum(const glm::mat<C, R, T, Q> &m){
+    double s = 0;
+    for (glm::length_t i = 0; i < C; i++) s += Sum(m[i]);
+    return s;
+}
+
+template <typename T, glm::qualifier Q>
+static double Sum(const glm::qua<T, Q> &q){
+    return (double)q.x + q.y + q.z + q.w;
+}
+
+static double Sum(float f){
+    return f;
+}
+
+template <typename T>
+static double Sum(const std::vector<T> &v){
+    double s = 0;
+    for (size_t i = 0; i < v.size(); i++) s += Sum(v[i]);
+    return s;
+}
+
+static double Seconds(Clock::time_point start){
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// f runs ITEM_COUNT operations into out. The repeat count grows until one
+// trial takes TRIAL_SECONDS, then the fastest of TRIAL_COUNT trials is kept,
+// which filters out most of the noise from other processes.
+template <typename F, typename T>
+static void Run(const char *name, const char *type, F f, const std::vector<T> &out){
+    f();
+    int repeats = 1;
+    for (;;) {
+        Clock::time_point start = Clock::now();
+        for (int r = 0; r < repeats; r++) f();
+        double seconds = Seconds(start);
+        if (seconds >= TRIAL_SECONDS) break;
+        repeats *= seconds < TRIAL_SECONDS / 16 ? 8 : 2;
+    }
+
+    double best = 0;
+    for (int t = 0; t < TRIAL_COUNT; t++) {
+        Clock::time_point start = Clock::now();
+        for (int r = 0; r < repeats; r++) f();
+        double seconds = Seconds(start);
+        if (t == 0 || seconds < best) best = seconds;
+    }
+
+    Result result = { name, type, best * 1e9 / ((double)repeats * ITEM_COUNT), Sum(out) };
+    results.push_back(result);
+}
+
+template <typename Vec3, typename Vec4, typename Mat4, typename Quat>
+static void RunTypes(const char *type){
+    std::vector<Mat4> ma(ITEM_COUNT), mb(ITEM_COUNT), mo(ITEM_COUNT);
+    std::vector<Vec4> va(ITEM_COUNT), vo(ITEM_COUNT);
+    std::vector<Vec3> pa(ITEM_COUNT), po(ITEM_COUNT);
+    std::vector<Quat> qa(ITEM_COUNT), qb(ITEM_COUNT), qo(ITEM_COUNT);
+    std::vector<float> fo(ITEM_COUNT);
+
+    glm::seedRandom(1);
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        Vec3 axis = Vec3(glm::sphericalRand(1.0f));
+        ma[i] = glm::rotate(glm::translate(Mat4(1), Vec3(glm::ballRand(10.0f))), glm::linearRand(-3.0f, 3.0f), axis);
+        mb[i] = glm::scale(Mat4(1), Vec3(glm::linearRand(glm::vec3(0.5f), glm::vec3(2.0f))));
+        va[i] = Vec4(glm::ballRand(10.0f), 1);
+        pa[i] = Vec3(glm::ballRand(10.0f));
+        qa[i] = glm::angleAxis(glm::linearRand(-3.0f, 3.0f), axis);
+        qb[i] = glm::angleAxis(glm::linearRand(-3.0f, 3.0f), Vec3(glm::sphericalRand(1.0f)));
+    }
+
+    Run("mat4 * mat4", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) mo[i] = ma[i] * mb[i]; }, mo);
+    Run("mat4 * vec4", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) vo[i] = ma[i] * va[i]; }, vo);
+    Run("inverse(mat4)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) mo[i] = glm::inverse(ma[i]); }, mo);
+    Run("transpose(mat4)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) mo[i] = glm::transpose(ma[i]); }, mo);
+    Run("translate(mat4)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) mo[i] = glm::translate(ma[i], pa[i]); }, mo);
+    Run("rotate(mat4)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) mo[i] = glm::rotate(ma[i], 0.5f, Vec3(0, 0, 1)); }, mo);
+    Run("normalize(vec4)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) vo[i] = glm::normalize(va[i]); }, vo);
+    Run("normalize(vec3)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) po[i] = glm::normalize(pa[i]); }, po);
+    Run("dot(vec4)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) fo[i] = glm::dot(va[i], vo[i]); }, fo);
+    Run("cross(vec3)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) po[i] = glm::cross(pa[i], Vec3(va[i])); }, po);
+    Run("quat * quat", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) qo[i] = qa[i] * qb[i]; }, qo);
+    Run("quat * vec3", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) po[i] = qa[i] * pa[i]; }, po);
+    Run("slerp(quat)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) qo[i] = glm::slerp(qa[i], qb[i], 0.3f); }, qo);
+    Run("normalize(quat)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) qo[i] = glm::normalize(qa[i]); }, qo);
+    Run("mat4_cast(quat)", type, [&]{ for (int i = 0; i < ITEM_COUNT; i++) mo[i] = glm::mat4_cast(qa[i]); }, mo);
+}
+
+static void RunNoise(){
+    std::vector<glm::vec2> p(ITEM_COUNT);
+    std::vector<float> out(ITEM_COUNT);
+    glm::seedRandom(2);
+    for (int i = 0; i < ITEM_COUNT; i++) p[i] = glm::linearRand(glm::vec2(-100), glm::vec2(100));
+
+    Run("perlin(vec2)", "default", [&]{ for (int i = 0; i < ITEM_COUNT; i++) out[i] = glm::perlin(p[i]); }, out);
+    Run("simplex(vec2)", "default", [&]{ for (int i = 0; i < ITEM_COUNT; i++) out[i] = glm::simplex(p[i]); }, out);
+    Run("perlinArray", "batch", [&]{ glm::perlinArray(&p[0].x, &out[0], ITEM_COUNT); }, out);
+    Run("simplexArray", "batch", [&]{ glm::simplexArray(&p[0].x, &out[0], ITEM_COUNT); }, out);
+}
+
+static const char *IsaName(){
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    return "avx2";
+#elif GLM_ARCH & GLM_ARCH_AVX_BIT
+    return "avx";
+#elif GLM_ARCH & GLM_ARCH_SSE42_BIT
+    return "sse4.2";
+#elif GLM_ARCH & GLM_ARCH_SSE41_BIT
+    return "sse4.1";
+#elif GLM_ARCH & GLM_ARCH_SSE3_BIT
+    return "sse3";
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    return "sse2";
+#elif GLM_ARCH & GLM_ARCH_NEON_BIT
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+static const char *CompilerName(){
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+static void PrintText(){
+    printf("isa %s, fma %s, aligned types %s, %s\n", IsaName(),
+#ifdef GLM_SIMD_FMA
+        "on",
+#else
+        "off",
+#endif
+        GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE ? "on" : "off", CompilerName());
+    printf("%-18s %-8s %10s %12s %16s\n", "function", "types", "ns/op", "Mops/s", "checksum");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &r = results[i];
+        printf("%-18s %-8s %10.3f %12.1f %16.6g\n", r.name, r.type, r.ns, 1e3 / r.ns, r.checksum);
+    }
+}
+
+// Names and the compiler string hold no quotes or backslashes, so no escaping is needed.
+static void PrintJson(){
+    printf("{\"isa\":\"%s\",\"fma\":%s,\"aligned_types\":%s,\"compiler\":\"%s\",\"items\":%d,\"results\":[",
+        IsaName(),
+#ifdef GLM_SIMD_FMA
+        "true",
+#else
+        "false",
+#endif
+        GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE ? "true" : "false", CompilerName(), ITEM_COUNT);
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &r = results[i];
+        printf("%s{\"name\":\"%s\",\"types\":\"%s\",\"ns_per_op\":%.4f,\"mops_per_s\":%.2f,\"checksum\":%.9g}",
+            i == 0 ? "" : ",", r.name, r.type, r.ns, 1e3 / r.ns, r.checksum);
+    }
+    printf("]}\n");
+}
+
+int main(int argc, char **argv){
+    bool json = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+    }
+
+    RunTypes<glm::vec3, glm::vec4, glm::mat4, glm::quat>("default");
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+    RunTypes<glm::aligned_vec3, glm::aligned_vec4, glm::aligned_mat4, glm::qua<float, glm::aligned_highp> >("aligned");
+#endif
+    RunNoise();
+
+    if (json) PrintJson();
+    else PrintText();
+    return 0;
+}
@@ -0,0 +1,39 @@
+// Throughput of the bulk half float converters in glm/gtc/packing.hpp
+// against the one-at-a-time packHalf1x16/unpackHalf1x16.
+// Build once per ISA and compare:
+//   g++ -O2 -std=c++11 -I.. half_bench.cpp                                  (scalar)
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. half_bench.cpp
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -mavx2 -mf16c -I.. half_bench.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/packing.hpp"
+#include "glm/gtc/random.hpp"
+
+#define ITEM_COUNT 65536
+#define REPEAT_COUNT 200
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename F>
+static void Measure(const char *name, F f, std::size_t items){
+    f();
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < REPEAT_COUNT; r++) f();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    printf("%-24s %7.3f ns/value\n", name, ns / ((double)items * REPEAT_COUNT));
+}
+
+int main(){
+    std::vector<float> values(ITEM_COUNT), back(ITEM_COUNT);
+    std::vector<glm::uint16> halves(ITEM_COUNT);
+    glm::linearRandFill(glm::randomEngine(), &values[0], ITEM_COUNT, -1000.0f, 1000.0f);
+
+    Measure("packHalf1x16 loop", [&]{ for (int i = 0; i < ITEM_COUNT; i++) halves[i] = glm::packHalf1x16(values[i]); }, ITEM_COUNT);
+    Measure("packHalfArray", [&]{ glm::packHalfArray(&values[0], &halves[0], ITEM_COUNT); }, ITEM_COUNT);
+    Measure("unpackHalf1x16 loop", [&]{ for (int i = 0; i < ITEM_COUNT; i++) back[i] = glm::unpackHalf1x16(halves[i]); }, ITEM_COUNT);
+    Measure("unpackHalfArray", [&]{ glm::unpackHalfArray(&halves[0], &back[0], ITEM_COUNT); }, ITEM_COUNT);
+    return 0;
+}
@@ -0,0 +1,75 @@
+// Per-step matrix cost of the TransformSystem against rebuilding every
+// entity's matrix each step, for a scene that is mostly static scenery with
+// some movers carrying riders. Also checks the riders follow their parents,
+// in both their matrices and their world positions.
+// Entity.cpp brings in the GL code, so link it like the game:
+//   g++ -O2 -std=c++11 -I.. $(sdl2-config --cflags) hierarchy_bench.cpp ../Transform.cpp
+//       ../Entity.cpp ../Animation.cpp ../ShaderProgram.cpp $(sdl2-config --libs) -lGL
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "Transform.h"
+
+#define ENTITY_COUNT 100000
+#define MOVER_COUNT 5000
+#define RIDER_COUNT 5000
+#define STEP_COUNT 200
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static double Since(Clock::time_point start){
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static void Move(std::vector<Entity> &entities, int step){
+    for (int i = 0; i < MOVER_COUNT; i++) {
+        entities[i].position.x += (step & 1) ? 0.01f : -0.01f;
+        entities[i].transformDirty = true;
+    }
+}
+
+int main(){
+    // Movers first, then riders, then scenery; riders hang off movers.
+    std::vector<Entity> entities(ENTITY_COUNT);
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        entities[i].position = RealVec3(glm::linearRand(-100.0f, 100.0f), glm::linearRand(-100.0f, 100.0f), 0);
+    }
+    TransformSystem transforms;
+    transforms.Build(&entities[0], ENTITY_COUNT);
+    for (int i = 0; i < RIDER_COUNT; i++) transforms.Attach(&entities[0], MOVER_COUNT + i, i % MOVER_COUNT);
+    transforms.Update(&entities[0]);
+
+    std::vector<Entity> everyStep = entities;
+    Clock::time_point start = Clock::now();
+    for (int step = 0; step < STEP_COUNT; step++) {
+        Move(everyStep, step);
+        for (int i = 0; i < ENTITY_COUNT; i++) {
+            Entity &entity = everyStep[i];
+            entity.modelMatrix = glm::translate(glm::mat3x2(1.0f), glm::vec2(glm::vec3(TransformSystem::WorldPosition(&everyStep[0], i))));
+        }
+    }
+    double all = Since(start) / STEP_COUNT;
+
+    start = Clock::now();
+    for (int step = 0; step < STEP_COUNT; step++) {
+        Move(entities, step);
+        transforms.Update(&entities[0]);
+    }
+    double lazy = Since(start) / STEP_COUNT;
+
+    int wrong = 0;
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        glm::vec2 world = glm::vec2(glm::vec3(TransformSystem::WorldPosition(&entities[0], i)));
+        glm::vec2 position = glm::vec2(glm::vec3(entities[i].position));
+        if (glm::any(glm::greaterThan(glm::abs(entities[i].modelMatrix[2] - world), glm::vec2(1e-4f)))) wrong++;
+        else if (glm::any(glm::greaterThan(glm::abs(position - world), glm::vec2(1e-4f)))) wrong++;
+    }
+
+    printf("%d entities, %d moving, %d riding on them\n", ENTITY_COUNT, MOVER_COUNT, RIDER_COUNT);
+    printf("every step    %8.1f us/step\n", all);
+    printf("dirty flags   %8.1f us/step, %d matrices rebuilt per step, %d wrong\n", lazy, transforms.updatedCount, wrong);
+    return 0;
+}
@@ -0,0 +1,106 @@
+// Ray vs box throughput of the batch slab tests in glm/gtx/intersect.hpp.
+// First checks that a ray running in a box's face plane (zero dir component,
+// origin on boxMin or on boxMax) hits on both faces, in every path.
+// Build once per ISA and compare:
+//   g++ -O2 -std=c++11 -I.. intersect_bench.cpp                                  (scalar)
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. intersect_bench.cpp
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -mavx2 -I.. intersect_bench.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#define GLM_ENABLE_EXPERIMENTAL
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "glm/gtx/intersect.hpp"
+
+#define BOX_COUNT 4096
+#define PACKET_SIZE 32
+#define REPEAT_COUNT 2000
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename F>
+static void Measure(const char *name, F f, std::size_t items){
+    f();
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < REPEAT_COUNT; r++) f();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    printf("%-28s %7.3f ns/test\n", name, ns / ((double)items * REPEAT_COUNT));
+}
+
+// Rays along +x (or -x) at the height of a box's bottom or top face, for
+// each face and each sign of the zero y component. 13 boxes and rays so the
+// AVX, SSE2 and scalar tail paths all see both faces.
+static void CheckFacePlanes(){
+    const int count = 13;
+    std::vector<float> minX(count), minY(count), maxX(count), maxY(count);
+    float ox[count], oy[count], dx[count], dy[count];
+    for (int i = 0; i < count; i++) {
+        minX[i] = 4; maxX[i] = 6;
+        minY[i] = -1; maxY[i] = 1;
+        ox[i] = 0; oy[i] = i % 2 ? 1.0f : -1.0f;
+        dx[i] = 1; dy[i] = i % 4 < 2 ? 0.0f : -0.0f;
+    }
+
+    int scalar = 0;
+    for (int i = 0; i < count; i++) {
+        float t;
+        if (glm::intersectRayAABB(glm::vec2(ox[i], oy[i]), glm::vec2(dx[i], dy[i]), glm::vec2(4, -1), glm::vec2(6, 1), t)) scalar++;
+    }
+
+    // One ray per face against the whole array.
+    glm::uint32 mask[1];
+    int array = 0;
+    for (int face = 0; face < 2; face++) {
+        for (int sign = 0; sign < 2; sign++) {
+            glm::vec3 orig(0, face ? 1.0f : -1.0f, 0), dir(1, sign ? -0.0f : 0.0f, 0);
+            array += (int)glm::intersectRayAABBArray(orig, dir, 50.0f, &minX[0], &minY[0], NULL, &maxX[0], &maxY[0], NULL, count, mask, NULL);
+        }
+    }
+
+    int packet = glm::bitCount(glm::intersectRayPacketAABB(ox, oy, NULL, dx, dy, NULL, count, 50.0f, glm::vec3(4, -1, 0), glm::vec3(6, 1, 0), NULL));
+    printf("face planes: intersectRayAABB %d/%d  Array %d/%d  Packet %d/%d\n", scalar, count, array, 4 * count, packet, count);
+}
+
+int main(){
+    CheckFacePlanes();
+
+    // 2D boxes the size of P4 entities spread over a level.
+    std::vector<float> minX(BOX_COUNT), minY(BOX_COUNT), maxX(BOX_COUNT), maxY(BOX_COUNT), distances(BOX_COUNT);
+    std::vector<glm::uint32> mask(BOX_COUNT / 32);
+    for (int i = 0; i < BOX_COUNT; i++) {
+        glm::vec2 center = glm::linearRand(glm::vec2(0, -4), glm::vec2(200, 4));
+        minX[i] = center.x - 0.5f; maxX[i] = center.x + 0.5f;
+        minY[i] = center.y - 0.5f; maxY[i] = center.y + 0.5f;
+    }
+
+    glm::vec3 orig(1, 0.2f, 0), dir = glm::normalize(glm::vec3(1, 0.01f, 0));
+    std::size_t hits = 0;
+
+    Measure("intersectRayAABB loop", [&]{
+        hits = 0;
+        for (int i = 0; i < BOX_COUNT; i++) {
+            float t;
+            if (glm::intersectRayAABB(glm::vec2(orig), glm::vec2(dir), glm::vec2(minX[i], minY[i]), glm::vec2(maxX[i], maxY[i]), t) && t <= 50.0f) hits++;
+        }
+    }, BOX_COUNT);
+    printf("  %d hits\n", (int)hits);
+
+    Measure("intersectRayAABBArray", [&]{
+        hits = glm::intersectRayAABBArray(orig, dir, 50.0f, &minX[0], &minY[0], NULL, &maxX[0], &maxY[0], NULL, BOX_COUNT, &mask[0], &distances[0]);
+    }, BOX_COUNT);
+    printf("  %d hits\n", (int)hits);
+
+    float ox[PACKET_SIZE], oy[PACKET_SIZE], dx[PACKET_SIZE], dy[PACKET_SIZE], pd[PACKET_SIZE];
+    for (int i = 0; i < PACKET_SIZE; i++) {
+        glm::vec2 d = glm::circularRand(1.0f);
+        ox[i] = orig.x; oy[i] = orig.y; dx[i] = d.x; dy[i] = d.y;
+    }
+    glm::uint32 packetMask = 0;
+    Measure("intersectRayPacketAABB x32", [&]{
+        packetMask = glm::intersectRayPacketAABB(ox, oy, NULL, dx, dy, NULL, PACKET_SIZE, 50.0f, glm::vec3(4, -1, 0), glm::vec3(6, 1, 0), pd);
+    }, PACKET_SIZE);
+    printf("  %d hits\n", glm::bitCount(packetMask));
+    return 0;
+}
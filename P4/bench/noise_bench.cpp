@@ -0,0 +1,61 @@
+// Speed and accuracy of the batch noise in glm/gtc/noise.hpp against the
+// single point perlin/simplex it replaces.
+// Build once per ISA and compare:
+//   g++ -O2 -std=c++11 -pthread -I.. noise_bench.cpp                                  (scalar)
+//   g++ -O2 -std=c++11 -pthread -DGLM_FORCE_SSE2 -I.. noise_bench.cpp
+//   g++ -O2 -std=c++11 -pthread -DGLM_FORCE_AVX2 -mavx2 -mfma -I.. noise_bench.cpp
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "glm/gtc/noise.hpp"
+
+#define GRID_SIZE 4096
+#define CHECK_COUNT 10000
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename F>
+static double Measure(F f){
+    Clock::time_point start = Clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int main(){
+    std::vector<float> xy(CHECK_COUNT * 2), out(CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++) {
+        xy[i * 2 + 0] = (float)((i * 37) % 1000) * 0.0731f - 30.0f;
+        xy[i * 2 + 1] = (float)((i * 91) % 997) * 0.0517f - 20.0f;
+    }
+
+    float perlinError = 0;
+    glm::perlinArray(&xy[0], &out[0], CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++)
+        perlinError = std::fmax(perlinError, std::fabs(out[i] - glm::perlin(glm::vec2(xy[i * 2], xy[i * 2 + 1]))));
+
+    float simplexError = 0;
+    glm::simplexArray(&xy[0], &out[0], CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++)
+        simplexError = std::fmax(simplexError, std::fabs(out[i] - glm::simplex(glm::vec2(xy[i * 2], xy[i * 2 + 1]))));
+
+    printf("max error vs scalar: perlin %g, simplex %g\n", perlinError, simplexError);
+
+    std::vector<float> grid((size_t)GRID_SIZE * GRID_SIZE);
+    glm::vec2 origin(-3.0f, 5.0f), step(0.01f, 0.01f);
+    int threads = (int)std::thread::hardware_concurrency();
+
+    double scalar = Measure([&]{
+        for (int y = 0; y < GRID_SIZE; y++)
+            for (int x = 0; x < GRID_SIZE; x++)
+                grid[(size_t)y * GRID_SIZE + x] = glm::perlin(origin + glm::vec2(x, y) * step);
+    });
+    printf("%dx%d perlin scalar loop    %8.1f ms\n", GRID_SIZE, GRID_SIZE, scalar);
+    printf("%dx%d perlinGrid            %8.1f ms\n", GRID_SIZE, GRID_SIZE, Measure([&]{ glm::perlinGrid(&grid[0], GRID_SIZE, GRID_SIZE, origin, step); }));
+    printf("%dx%d simplexGrid           %8.1f ms\n", GRID_SIZE, GRID_SIZE, Measure([&]{ glm::simplexGrid(&grid[0], GRID_SIZE, GRID_SIZE, origin, step); }));
+    printf("%dx%d perlinGrid, %d threads %8.1f ms\n", GRID_SIZE, GRID_SIZE, threads, Measure([&]{ glm::perlinGrid(&grid[0], GRID_SIZE, GRID_SIZE, origin, step, 1, 2.0f, 0.5f, threads); }));
+    printf("%dx%d perlinGrid, 4 octaves %8.1f ms\n", GRID_SIZE, GRID_SIZE, Measure([&]{ glm::perlinGrid(&grid[0], GRID_SIZE, GRID_SIZE, origin, step, 4, 2.0f, 0.5f, threads); }));
+    return 0;
+}
@@ -0,0 +1,54 @@
+// Sustained particle throughput of ParticleSystem: emitters keep the ring
+// full, and the cost of Emit + Update per step gives the number of live
+// particles one millisecond of CPU keeps going.
+// Particles.cpp brings in the GL code, so link it like the game; the SIMD
+// update needs GLM_FORCE_SSE2, leave it out for the scalar loop:
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. $(sdl2-config --cflags) particle_bench.cpp ../Particles.cpp
+//       ../ShaderProgram.cpp $(sdl2-config --libs) -lGL
+
+#include <chrono>
+#include <cstdio>
+#include "glm/glm.hpp"
+#include "Particles.h"
+
+#define LIFETIME 0.5f
+#define STEP_COUNT 300
+#define STEP_TIME 0.0166666f
+
+typedef std::chrono::high_resolution_clock Clock;
+
+int main(){
+    int sizes[] = { 10000, 100000, 1000000 };
+
+    printf("%10s %12s %12s %16s\n", "particles", "emit us", "update us", "particles/ms");
+    for (int size : sizes) {
+        ParticleSystem particles;
+        particles.Init(size, LIFETIME);
+        particles.gravity = glm::vec2(0, -9.81f);
+
+        // Enough emitters at the default settings to refill the ring once per lifetime.
+        ParticleEmitter emitter;
+        emitter.rate = size / LIFETIME;
+
+        double emit = 0, update = 0;
+        for (int step = 0; step < STEP_COUNT; step++) {
+            Clock::time_point start = Clock::now();
+            particles.Emit(emitter, glm::vec2(0), STEP_TIME);
+            Clock::time_point middle = Clock::now();
+            particles.Update(STEP_TIME);
+            Clock::time_point end = Clock::now();
+
+            // Skip the first lifetime, while the ring fills up.
+            if (step * STEP_TIME < LIFETIME) continue;
+            emit += std::chrono::duration<double, std::micro>(middle - start).count();
+            update += std::chrono::duration<double, std::micro>(end - middle).count();
+        }
+
+        int measured = STEP_COUNT - (int)(LIFETIME / STEP_TIME) - 1;
+        emit /= measured;
+        update /= measured;
+        printf("%10d %12.1f %12.1f %16.0f\n", particles.count, emit, update, particles.count / ((emit + update) / 1000.0));
+        particles.Free();
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+// ProjectileSystem::Update cost for a large bullet count over a tile map
+// with walls and a target, against the same bullets as an array of structs
+// updated one at a time. Dead bullets are respawned so the count holds.
+// Projectile.cpp brings in the GL code, so link it like the game; the SIMD
+// pass needs GLM_FORCE_SSE2, leave it out for the scalar loop:
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. $(sdl2-config --cflags) projectile_bench.cpp ../Projectile.cpp
+//       ../Entity.cpp ../Animation.cpp ../ShaderProgram.cpp $(sdl2-config --libs) -lGL
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "Projectile.h"
+
+#define BULLET_COUNT 100000
+#define MAP_SIZE 256
+#define WALL_CHANCE 0.02f
+#define STEP_COUNT 300
+#define STEP_TIME 0.0166666f
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Bullet {
+    float x, y, vx, vy, life;
+};
+
+static Bullet Random(){
+    Bullet b;
+    b.x = glm::linearRand(0.0f, (float)MAP_SIZE);
+    b.y = glm::linearRand(0.0f, (float)MAP_SIZE);
+    glm::vec2 v = glm::circularRand(PROJECTILE_SPEED);
+    b.vx = v.x;
+    b.vy = v.y;
+    b.life = glm::linearRand(1.0f, 5.0f);
+    return b;
+}
+
+int main(){
+    TileGrid<glm::uint8> tiles;
+    tiles.Init(MAP_SIZE, MAP_SIZE, 0);
+    for (int y = 0; y < MAP_SIZE; y++)
+        for (int x = 0; x < MAP_SIZE; x++)
+            if (glm::linearRand(0.0f, 1.0f) < WALL_CHANCE) tiles.At(x, y) = 1;
+
+    Entity target;
+    target.position = RealVec3(MAP_SIZE / 2, MAP_SIZE / 2, 0);
+    target.width = target.height = 8;
+
+    std::vector<Bullet> spawns(BULLET_COUNT * 4);
+    for (size_t i = 0; i < spawns.size(); i++) spawns[i] = Random();
+
+    // Structure of arrays, one SIMD pass per step.
+    ProjectileSystem projectiles;
+    projectiles.Init(BULLET_COUNT);
+    size_t next = 0;
+    double soa = 0;
+    long removed = 0, hits = 0;
+    for (int step = 0; step < STEP_COUNT; step++) {
+        while (projectiles.count < BULLET_COUNT) {
+            const Bullet &b = spawns[next++ % spawns.size()];
+            projectiles.Spawn(b.x, b.y, b.vx, b.vy, b.life);
+        }
+        Clock::time_point start = Clock::now();
+        projectiles.Update(STEP_TIME, tiles, RealVec3(0), 1, &target);
+        soa += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        removed += projectiles.removedCount;
+        hits += projectiles.hitCount;
+    }
+
+    // Array of structs, one bullet at a time.
+    std::vector<Bullet> bullets;
+    next = 0;
+    double aos = 0;
+    float reach = (float)target.width / 2 + PROJECTILE_SIZE / 2;
+    for (int step = 0; step < STEP_COUNT; step++) {
+        while ((int)bullets.size() < BULLET_COUNT) bullets.push_back(spawns[next++ % spawns.size()]);
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < bullets.size();) {
+            Bullet &b = bullets[i];
+            b.x += b.vx * STEP_TIME;
+            b.y += b.vy * STEP_TIME;
+            b.life -= STEP_TIME;
+            bool dead = b.life <= 0 || b.x < 0 || b.y < 0 || b.x >= MAP_SIZE || b.y >= MAP_SIZE
+                || (fabsf(b.x - (float)target.position.x) < reach && fabsf(b.y - (float)target.position.y) < reach)
+                || tiles.At((int)b.x, (int)b.y) != 0;
+            if (dead) {
+                b = bullets.back();
+                bullets.pop_back();
+            }
+            else i++;
+        }
+        aos += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+
+    printf("%d bullets on a %dx%d map, %d%% walls\n", BULLET_COUNT, MAP_SIZE, MAP_SIZE, (int)(WALL_CHANCE * 100));
+    printf("array of structs  %8.1f us/step\n", aos / STEP_COUNT);
+    printf("ProjectileSystem  %8.1f us/step, %.0f removed and %.1f hits per step, budget %.0f us\n",
+        soa / STEP_COUNT, (double)removed / STEP_COUNT, (double)hits / STEP_COUNT, STEP_TIME * 1e6);
+
+    projectiles.Free();
+    tiles.Free();
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Accuracy and throughput of slerpArray, nlerpArray and rotateArray from
+// glm/gtx/quaternion.hpp against the scalar slerp, normalize(mix) and rotate.
+// Errors are the largest absolute component difference from the scalar result.
+// Build once per ISA and compare:
+//   g++ -O2 -std=c++11 -I.. quat_bench.cpp                                  (scalar)
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. quat_bench.cpp
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -mavx2 -mfma -I.. quat_bench.cpp
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "glm/gtx/quaternion.hpp"
+
+#define ITEM_COUNT 1024
+#define REPEAT_COUNT 2000
+#define CHECK_COUNT 1000003
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename F>
+static double Measure(F f){
+    f();
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < REPEAT_COUNT; r++) f();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ((double)ITEM_COUNT * REPEAT_COUNT);
+}
+
+static void Report(const char *name, double scalar, double array){
+    printf("%-8s scalar %6.2f ns   array %6.2f ns   x%.1f\n", name, scalar, array, scalar / array);
+}
+
+static glm::quat RandomQuat(){
+    return glm::angleAxis(glm::linearRand(-3.14159f, 3.14159f), glm::sphericalRand(1.0f));
+}
+
+static float Diff(const glm::quat &a, const glm::quat &b){
+    return glm::max(glm::max(std::fabs(a.x - b.x), std::fabs(a.y - b.y)), glm::max(std::fabs(a.z - b.z), std::fabs(a.w - b.w)));
+}
+
+static glm::quat Nlerp(const glm::quat &x, const glm::quat &y, float a){
+    return glm::normalize(glm::lerp(x, glm::dot(x, y) < 0.0f ? -y : y, a));
+}
+
+int main(){
+    std::vector<glm::quat> x(CHECK_COUNT), y(CHECK_COUNT), r(CHECK_COUNT);
+    std::vector<glm::vec3> v(CHECK_COUNT), rv(CHECK_COUNT);
+    std::vector<float> a(CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++) {
+        x[i] = RandomQuat();
+        // A quarter of the pairs are nearly equal, to reach the linear fallback.
+        y[i] = i % 4 ? RandomQuat() : glm::normalize(x[i] + glm::quat(glm::linearRand(-1e-4f, 1e-4f), 0.0f, 0.0f, 0.0f));
+        if (i % 2) y[i] = -y[i];
+        a[i] = glm::linearRand(0.0f, 1.0f);
+        v[i] = glm::ballRand(10.0f);
+    }
+
+    float slerpErr = 0, nlerpErr = 0, rotateErr = 0;
+    glm::slerpArray(&x[0], &y[0], &a[0], &r[0], CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++) slerpErr = glm::max(slerpErr, Diff(r[i], glm::slerp(x[i], y[i], a[i])));
+    glm::nlerpArray(&x[0], &y[0], &a[0], &r[0], CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++) nlerpErr = glm::max(nlerpErr, Diff(r[i], Nlerp(x[i], y[i], a[i])));
+    glm::rotateArray(&x[0], &v[0], &rv[0], CHECK_COUNT);
+    for (int i = 0; i < CHECK_COUNT; i++) {
+        glm::vec3 d = glm::abs(rv[i] - glm::rotate(x[i], v[i]));
+        rotateErr = glm::max(rotateErr, glm::max(d.x, glm::max(d.y, d.z)) / 10.0f);
+    }
+    printf("slerpArray  max error %.3g\n", slerpErr);
+    printf("nlerpArray  max error %.3g\n", nlerpErr);
+    printf("rotateArray max error %.3g (relative to |v| <= 10)\n\n", rotateErr);
+
+    Report("slerp", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) r[i] = glm::slerp(x[i], y[i], a[i]); }),
+        Measure([&]{ glm::slerpArray(&x[0], &y[0], &a[0], &r[0], ITEM_COUNT); }));
+    Report("nlerp", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) r[i] = Nlerp(x[i], y[i], a[i]); }),
+        Measure([&]{ glm::nlerpArray(&x[0], &y[0], &a[0], &r[0], ITEM_COUNT); }));
+    Report("rotate", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) rv[i] = glm::rotate(x[i], v[i]); }),
+        Measure([&]{ glm::rotateArray(&x[0], &v[0], &rv[0], ITEM_COUNT); }));
+    return 0;
+}
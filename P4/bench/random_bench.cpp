@@ -0,0 +1,50 @@
+// Compares glm's random functions with the old std::rand based path.
+// g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. random_bench.cpp -o random_bench
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+
+#define SAMPLE_COUNT 10000000
+
+// What glm::linearRand(float, float) did before: four std::rand() bytes per float.
+static float StdRandLinear(float Min, float Max){
+    glm::uint32 bits = 0;
+    for (int i = 0; i < 4; i++) bits = (bits << 8) | (glm::uint32)(std::rand() % 255);
+    return (float)bits / (float)0xFFFFFFFFu * (Max - Min) + Min;
+}
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static void Report(const char *name, Clock::time_point start, float check){
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    printf("%-28s %7.3f ns/float  (%g)\n", name, ns / SAMPLE_COUNT, check);
+}
+
+int main(){
+    std::vector<float> out(SAMPLE_COUNT);
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < SAMPLE_COUNT; i++) out[i] = StdRandLinear(-1.0f, 1.0f);
+    Report("std::rand bytes", start, out[SAMPLE_COUNT - 1]);
+
+    glm::seedRandom(1);
+    start = Clock::now();
+    for (int i = 0; i < SAMPLE_COUNT; i++) out[i] = glm::linearRand(-1.0f, 1.0f);
+    Report("glm::linearRand", start, out[SAMPLE_COUNT - 1]);
+
+    glm::xoshiro256pp engine(1);
+    start = Clock::now();
+    glm::linearRandFill(engine, &out[0], out.size(), -1.0f, 1.0f);
+    Report("glm::linearRandFill", start, out[SAMPLE_COUNT - 1]);
+
+    std::vector<glm::vec4> vecs(SAMPLE_COUNT / 4);
+    start = Clock::now();
+    glm::linearRandFill(engine, &vecs[0], vecs.size(), glm::vec4(-1), glm::vec4(1));
+    Report("glm::linearRandFill vec4", start, vecs.back().w);
+
+    return 0;
+}
@@ -0,0 +1,354 @@
+// Scaling sweep over generated scenes (Scene.h). For each size N it builds a
+// level of about N entities in the GameState layout, runs a fixed number of
+// steps and times every phase of a step. A power law t = c * N^k is fitted
+// to each phase, so a phase whose exponent creeps up between runs stands out.
+//
+// Step() is main.cpp's fixed step with the same systems in the same order,
+// keep the two in step. The differences: the player's Update is split open
+// so its collision passes are timed apart, RIGHT is held every step so the
+// player never sleeps, there is no rollback or replay, and a hit does not
+// end the run. The flow field covers the view around the player's start,
+// like the game's. Enemies collide against every tile, so enemy_update
+// grows with enemies * tiles; the default --max stops at 10000, as 100000
+// takes minutes.
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. $(sdl2-config --cflags) scene_sweep.cpp ../Scene.cpp ../Text.cpp
+//       ../AI.cpp ../Broadphase.cpp ../FlowField.cpp ../Projectile.cpp ../Particles.cpp ../Sleep.cpp
+//       ../UpdateScheduler.cpp ../Transform.cpp ../Entity.cpp ../Animation.cpp ../ShaderProgram.cpp
+//       $(sdl2-config --libs) -lGL -pthread
+// Add -DSWEEP_RENDER to also time the entity sprites' Render() and DrawText
+// in a hidden window, and run it from P4 so the shaders load.
+//   scene_sweep [--max N] [--steps S] [--csv file] [--json file]
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include "AI.h"
+#include "Animation.h"
+#include "Broadphase.h"
+#include "FlowField.h"
+#include "Particles.h"
+#include "Projectile.h"
+#include "Scene.h"
+#include "Sleep.h"
+#include "Text.h"
+#include "Transform.h"
+#include "UpdateScheduler.h"
+
+#define STEP_TIME 0.0166666f
+#define STEP_COUNT 30
+#define DEFAULT_MAX 10000
+
+// The game's flow field and view, centred on the player's start.
+#define FLOW_TILE_SIZE 0.25f
+#define FLOW_WIDTH 40
+#define FLOW_HEIGHT 30
+
+// Phases slower than this (us/step) go into the fit; quicker ones are noise.
+#define FIT_FLOOR 0.05
+
+typedef std::chrono::high_resolution_clock Clock;
+
+enum Phase {
+    SLEEP, PLAYER_Y, PLAYER_X, PAIRS, FLOW, SCHEDULE, AI, ENEMIES, ANIMATION, PROJECTILES, SPARKS, TRANSFORMS,
+#ifdef SWEEP_RENDER
+    RENDER, TEXT,
+#endif
+    PHASE_COUNT
+};
+
+static const char *phaseNames[] = {
+    "sleep", "collisions_y", "collisions_x", "pairs", "flow_field", "schedule", "ai", "enemy_update",
+    "animation", "projectiles", "sparks", "transforms",
+#ifdef SWEEP_RENDER
+    "render", "draw_text",
+#endif
+};
+
+struct Fit {
+    double exponent = 0;
+    double coefficient = 0;
+    int points = 0;
+};
+
+#ifdef SWEEP_RENDER
+static ShaderProgram program;
+#endif
+
+class Timer {
+public:
+    Clock::time_point start;
+    double *phases;
+
+    Timer(double *phases) : phases(phases) { start = Clock::now(); }
+
+    void Lap(Phase phase){
+        Clock::time_point now = Clock::now();
+        phases[phase] += std::chrono::duration<double, std::micro>(now - start).count();
+        start = now;
+    }
+};
+
+// Everything main.cpp keeps in globals for one level.
+struct Sweep {
+    GameState state;
+    int entityCount = 0;
+    int tileCount = 0;
+    int enemyCount = 0;
+
+    AISystem ai;
+    SweepAndPrune broadphase;
+    FlowField flowField;
+    UpdateScheduler scheduler;
+    SleepSystem sleepSystem;
+    TransformSystem transforms;
+    ProjectileSystem projectiles;
+    ParticleSystem sparks;
+};
+
+// main.cpp's fixed step; see the header for where it differs.
+static void Step(Sweep &world, unsigned int step, double *phases){
+    GameState &state = world.state;
+    Entity &player = *state.player;
+    Timer timer(phases);
+
+    // ApplyInput with RIGHT held.
+    player.movement = RealVec3(1, 0, 0);
+    world.sleepSystem.Wake(state.player);
+    world.sleepSystem.Flush();
+    timer.Lap(SLEEP);
+
+    // Entity::Update for the player, split at its collision passes.
+    player.collidedTop = player.collidedBottom = player.collidedLeft = player.collidedRight = false;
+    if (player.jump) {
+        player.jump = false;
+        player.velocity.y += player.jumpPower;
+    }
+    player.velocity.x = player.movement.x * player.speed;
+    player.velocity += player.acceleration * STEP_TIME;
+    player.position.y += player.velocity.y * STEP_TIME;
+    player.CheckCollisionsY(state.platforms, world.tileCount);
+    timer.Lap(PLAYER_Y);
+
+    player.position.x += player.velocity.x * STEP_TIME;
+    player.CheckCollisionsX(state.platforms, world.tileCount);
+    player.CountRest();
+    player.transformDirty = true;
+    timer.Lap(PLAYER_X);
+
+    // ResolvePairs.
+    world.broadphase.Update();
+    world.sleepSystem.WakeContacts(world.broadphase.pairs);
+    for (size_t i = 0; i < world.broadphase.pairs.size(); i++) {
+        Entity *a = world.broadphase.pairs[i].a;
+        Entity *b = world.broadphase.pairs[i].b;
+        if (b->entityType == PLAYER) std::swap(a, b);
+        if (a->entityType != PLAYER || b->entityType != ENEMY) continue;
+
+        bool wasActive = b->isActive;
+        a->JumpEnemy(b);
+        if (wasActive && b->isActive == false) world.sparks.Burst(glm::vec2(glm::vec3(b->position)), 64, 3.0f);
+    }
+    timer.Lap(PAIRS);
+
+    world.flowField.Follow(player.position);
+    timer.Lap(FLOW);
+
+    world.scheduler.Begin(state.entities, step, STEP_TIME);
+    timer.Lap(SCHEDULE);
+
+    world.ai.Update(state.player);
+    timer.Lap(AI);
+
+    for (int i = 0; i < world.enemyCount; i++) {
+        Entity &enemy = state.enemies[i];
+        if (enemy.updateDue == false) continue;
+        enemy.Update(enemy.updateTime, state.platforms, world.tileCount, state.enemies, world.enemyCount);
+    }
+    timer.Lap(ENEMIES);
+
+    animations.Advance(state.entities, world.entityCount);
+    world.scheduler.End();
+    timer.Lap(ANIMATION);
+
+    if (world.projectiles.Update(STEP_TIME, world.flowField.blocked, world.flowField.origin, world.flowField.tileSize, state.player)) {
+        player.isDead = true;
+        world.sparks.Burst(glm::vec2(glm::vec3(player.position)), 64, 3.0f);
+    }
+    timer.Lap(PROJECTILES);
+
+    world.sparks.Update(STEP_TIME);
+    world.sleepSystem.Flush();
+    timer.Lap(SPARKS);
+
+    world.transforms.Update(state.entities);
+    timer.Lap(TRANSFORMS);
+
+#ifdef SWEEP_RENDER
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (int i = 0; i < world.entityCount; i++) state.entities[i].Render(&program);
+    glFinish();
+    timer.Lap(RENDER);
+
+    DrawText(&program, 0, "Defeat your opponents! Good luck!", 0.4f, -0.25f, glm::vec3(-2.25, 0, 0));
+    DrawText(&program, 0, "Press B to begin battle", 0.4f, -0.25f, glm::vec3(-1.25, -1, 0));
+    glFinish();
+    timer.Lap(TEXT);
+#endif
+}
+
+// Sets a level of about size entities up the way Initialize() does, runs
+// steps steps on it and returns the average time of each phase per step.
+static std::vector<double> Run(int size, int steps){
+    SceneSpec spec;
+    spec.platformCount = std::max(1, size / 2);
+    spec.wallCount = size / 4;
+    spec.enemyCount = std::max(1, size / 4);
+
+    Sweep *world = new Sweep();
+    GameState &state = world->state;
+    world->entityCount = GenerateScene(state, spec);
+    world->tileCount = spec.platformCount + spec.wallCount;
+    world->enemyCount = spec.enemyCount;
+
+    glm::vec2 view = glm::vec2(glm::vec3(state.player->position));
+    glm::vec2 half = glm::vec2(FLOW_WIDTH, FLOW_HEIGHT) * (FLOW_TILE_SIZE / 2.0f);
+
+    world->ai.Build(state.enemies, spec.enemyCount);
+    world->flowField.Init(FLOW_WIDTH, FLOW_HEIGHT, RealVec3(view.x - half.x, view.y - half.y, 0), FLOW_TILE_SIZE);
+    for (int i = 0; i < world->tileCount; i++) {
+        world->flowField.Block(state.platforms[i].position, state.platforms[i].width, state.platforms[i].height);
+    }
+    world->ai.field = &world->flowField;
+    world->projectiles.Init(PROJECTILE_CAPACITY);
+    world->ai.projectiles = &world->projectiles;
+    world->sparks.Init(4096, 0.5f);
+    world->sparks.gravity = glm::vec2(0, -9.81f);
+    world->scheduler.SetView(view - half, view + half);
+    world->scheduler.Rebuild(state.entities, world->entityCount, 0);
+    world->transforms.Build(state.entities, world->entityCount);
+    world->transforms.Update(state.entities);
+
+    world->broadphase.Add(state.player);
+    for (int i = 0; i < spec.enemyCount; i++) world->broadphase.Add(&state.enemies[i]);
+
+    std::vector<double> phases(PHASE_COUNT, 0.0);
+    for (int step = 0; step < steps; step++) Step(*world, step, &phases[0]);
+    for (int p = 0; p < PHASE_COUNT; p++) phases[p] /= steps;
+
+    world->flowField.Free();
+    world->projectiles.Free();
+    world->sparks.Free();
+    delete[] state.entities;
+    delete world;
+    return phases;
+}
+
+// Least squares line through (log n, log t).
+static Fit FitPowerLaw(const std::vector<int> &sizes, const std::vector<std::vector<double> > &times, int phase){
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+    Fit fit;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        if (times[i][phase] < FIT_FLOOR) continue;
+        double x = log((double)sizes[i]), y = log(times[i][phase]);
+        sx += x; sy += y; sxx += x * x; sxy += x * y;
+        fit.points++;
+    }
+    if (fit.points < 2) return fit;
+
+    double n = fit.points;
+    fit.exponent = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    fit.coefficient = exp((sy - fit.exponent * sx) / n);
+    return fit;
+}
+
+static void WriteCsv(const char *path, const std::vector<int> &sizes, const std::vector<std::vector<double> > &times){
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        printf("Unable to write %s\n", path);
+        return;
+    }
+    fprintf(file, "entities,phase,us_per_step\n");
+    for (size_t i = 0; i < sizes.size(); i++)
+        for (int p = 0; p < PHASE_COUNT; p++) fprintf(file, "%d,%s,%.3f\n", sizes[i], phaseNames[p], times[i][p]);
+    fclose(file);
+}
+
+static void WriteJson(const char *path, int steps, const std::vector<int> &sizes,
+    const std::vector<std::vector<double> > &times, const std::vector<Fit> &fits){
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        printf("Unable to write %s\n", path);
+        return;
+    }
+    fprintf(file, "{\"steps\":%d,\"entities\":[", steps);
+    for (size_t i = 0; i < sizes.size(); i++) fprintf(file, "%s%d", i ? "," : "", sizes[i]);
+    fprintf(file, "],\"phases\":[");
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        fprintf(file, "%s{\"name\":\"%s\",\"us_per_step\":[", p ? "," : "", phaseNames[p]);
+        for (size_t i = 0; i < sizes.size(); i++) fprintf(file, "%s%.3f", i ? "," : "", times[i][p]);
+        fprintf(file, "],\"exponent\":%.3f,\"coefficient\":%.6g,\"fit_points\":%d}", fits[p].exponent, fits[p].coefficient, fits[p].points);
+    }
+    fprintf(file, "]}\n");
+    fclose(file);
+}
+
+int main(int argc, char **argv){
+    int maxSize = DEFAULT_MAX;
+    int steps = STEP_COUNT;
+    const char *csvPath = NULL;
+    const char *jsonPath = NULL;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--max") == 0) maxSize = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--steps") == 0) steps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--csv") == 0) csvPath = argv[++i];
+        else if (strcmp(argv[i], "--json") == 0) jsonPath = argv[++i];
+    }
+
+#ifdef SWEEP_RENDER
+    SDL_Init(SDL_INIT_VIDEO);
+    SDL_Window *window = SDL_CreateWindow("sweep", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 640, 480, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    SDL_GLContext context = SDL_GL_CreateContext(window);
+    SDL_GL_MakeCurrent(window, context);
+#ifdef _WINDOWS
+    glewInit();
+#endif
+    glViewport(0, 0, 640, 480);
+    program.Load("shaders/vertex_textured.glsl", "shaders/fragment_textured.glsl");
+    program.SetProjectionMatrix(glm::ortho(-5.0f, 5.0f, -3.75f, 3.75f, -1.0f, 1.0f));
+    program.SetViewMatrix(glm::mat4(1.0f));
+#endif
+
+    std::vector<int> sizes;
+    std::vector<std::vector<double> > times;
+    for (int size = 10; size <= maxSize; size *= 10) {
+        sizes.push_back(size);
+        times.push_back(Run(size, steps));
+    }
+
+    std::vector<Fit> fits(PHASE_COUNT);
+    for (int p = 0; p < PHASE_COUNT; p++) fits[p] = FitPowerLaw(sizes, times, p);
+
+    printf("us/step over %d steps\n%-14s", steps, "phase");
+    for (size_t i = 0; i < sizes.size(); i++) printf(" %11d", sizes[i]);
+    printf("   fit\n");
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        printf("%-14s", phaseNames[p]);
+        for (size_t i = 0; i < sizes.size(); i++) printf(" %11.2f", times[i][p]);
+        if (fits[p].points >= 2) printf("   %.3g * N^%.2f\n", fits[p].coefficient, fits[p].exponent);
+        else printf("   -\n");
+    }
+
+    if (csvPath != NULL) WriteCsv(csvPath, sizes, times);
+    if (jsonPath != NULL) WriteJson(jsonPath, steps, sizes, times, fits);
+
+#ifdef SWEEP_RENDER
+    SDL_GL_DeleteContext(context);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+#endif
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Per-step cost of the enemy AI, update and animation with the UpdateScheduler
+// against running every enemy every step, for a crowd spread far around the
+// view. Entity.cpp brings in the GL code, so link it like the game:
+//   g++ -O2 -std=c++11 -I.. $(sdl2-config --cflags) schedule_bench.cpp ../UpdateScheduler.cpp ../AI.cpp
+//       ../FlowField.cpp ../Projectile.cpp ../Entity.cpp ../Animation.cpp ../ShaderProgram.cpp $(sdl2-config --libs) -lGL -pthread
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "AI.h"
+#include "Animation.h"
+#include "UpdateScheduler.h"
+
+#define ENEMY_COUNT 20000
+#define WORLD_SIZE 120.0f
+#define STEP_COUNT 800
+#define STEP_TIME 0.0166666f
+
+// Every entity starts in tier 0, so the first steps run everyone once.
+#define WARMUP_STEPS 8
+
+typedef std::chrono::high_resolution_clock Clock;
+
+struct Result {
+    double average = 0, worst = 0;
+    int minDue = ENEMY_COUNT, maxDue = 0;
+};
+
+static Result Run(std::vector<Entity> &entities, UpdateScheduler &scheduler){
+    Entity *player = &entities[0];
+    Entity *enemies = &entities[1];
+    AISystem ai;
+    ai.Build(enemies, ENEMY_COUNT);
+    scheduler.Rebuild(&entities[0], (int)entities.size(), 0);
+
+    Result result;
+    for (int step = 0; step < STEP_COUNT; step++) {
+        Clock::time_point start = Clock::now();
+        scheduler.Begin(&entities[0], step, STEP_TIME);
+        ai.Update(player);
+        for (size_t i = 0; i < scheduler.due.size(); i++) {
+            Entity &entity = entities[scheduler.due[i]];
+            entity.Update(entity.updateTime, NULL, 0, NULL, 0);
+        }
+        animations.Advance(&entities[0], (int)entities.size());
+        scheduler.End();
+        double time = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        if (step < WARMUP_STEPS) continue;
+
+        result.average += time / (STEP_COUNT - WARMUP_STEPS);
+        result.worst = std::max(result.worst, time);
+        result.minDue = std::min(result.minDue, (int)scheduler.due.size());
+        result.maxDue = std::max(result.maxDue, (int)scheduler.due.size());
+    }
+    return result;
+}
+
+int main(){
+    int atlas = animations.AddAtlas(4, 4);
+    int cells[] = { 0, 1, 2, 3 };
+    int clip = animations.AddClip(atlas, cells, 4);
+
+    std::vector<Entity> world(1 + ENEMY_COUNT);
+    world[0].entityType = PLAYER;
+    for (int i = 1; i <= ENEMY_COUNT; i++) {
+        Entity &enemy = world[i];
+        enemy.entityType = ENEMY;
+        enemy.aiType = (AIType)glm::linearRand(0, AI_TYPE_COUNT - 1);
+        enemy.aiState = WALKING;
+        enemy.animClip = clip;
+        enemy.position = RealVec3(glm::linearRand(-WORLD_SIZE, WORLD_SIZE), glm::linearRand(-WORLD_SIZE, WORLD_SIZE), 0);
+    }
+
+    UpdateScheduler everyStep;
+    for (int t = 0; t < UPDATE_TIER_COUNT; t++) everyStep.period[t] = 1;
+    everyStep.SetView(glm::vec2(-5.0f, -3.75f), glm::vec2(5.0f, 3.75f));
+    UpdateScheduler tiered;
+    tiered.SetView(glm::vec2(-5.0f, -3.75f), glm::vec2(5.0f, 3.75f));
+
+    std::vector<Entity> copy = world;
+    Result all = Run(copy, everyStep);
+    copy = world;
+    Result lod = Run(copy, tiered);
+
+    printf("%d enemies over %gx%g, view 10x7.5\n", ENEMY_COUNT, 2 * WORLD_SIZE, 2 * WORLD_SIZE);
+    printf("tiers (period):");
+    for (int t = 0; t < UPDATE_TIER_COUNT; t++) printf("  %d (%d)", tiered.tierCount[t], tiered.period[t]);
+    printf("\n");
+    printf("every step    %8.1f us/step, worst %8.1f, due %d..%d\n", all.average, all.worst, all.minDue, all.maxDue);
+    printf("tiered        %8.1f us/step, worst %8.1f, due %d..%d\n", lod.average, lod.worst, lod.minDue, lod.maxDue);
+    printf("saved         %8.1f us/step measured, %.1f us/step estimated by the scheduler\n",
+        all.average - lod.average, tiered.savedTime);
+    return 0;
+}
@@ -0,0 +1,68 @@
+// Per-step cost of a crowd of player-type bodies standing on a floor, most
+// of them idle, with and without sleeping. A window of bodies gets input
+// each step and moves along, so the rest have to settle and fall asleep.
+// Entity.cpp brings in the GL code, so link it like the game:
+//   g++ -O2 -std=c++11 -I.. $(sdl2-config --cflags) sleep_bench.cpp ../Sleep.cpp
+//       ../Entity.cpp ../Animation.cpp ../ShaderProgram.cpp $(sdl2-config --libs) -lGL
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "Sleep.h"
+
+#define BODY_COUNT 10000
+#define FLOOR_COUNT 64
+#define WINDOW_SIZE 100
+#define WINDOW_SPEED 10
+#define STEP_COUNT 600
+#define STEP_TIME 0.0166666f
+
+typedef std::chrono::high_resolution_clock Clock;
+
+static void Run(const char *name, std::vector<Entity> bodies, std::vector<Entity> &floor, bool sleep){
+    SleepSystem sleepSystem;
+    double total = 0, awake = 0;
+
+    for (int step = 0; step < STEP_COUNT; step++) {
+        int first = (step * WINDOW_SPEED) % BODY_COUNT;
+        for (int i = 0; i < BODY_COUNT; i++) {
+            Entity &body = bodies[i];
+            bool driven = (i - first + BODY_COUNT) % BODY_COUNT < WINDOW_SIZE;
+            body.movement = RealVec3(driven ? (i & 1 ? 1.0f : -1.0f) : 0.0f, 0, 0);
+            if (driven || sleep == false) sleepSystem.Wake(&body);
+        }
+
+        Clock::time_point start = Clock::now();
+        sleepSystem.Flush();
+        for (int i = 0; i < BODY_COUNT; i++) bodies[i].Update(STEP_TIME, &floor[0], FLOOR_COUNT, NULL, 0);
+        total += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+        awake += BODY_COUNT - SleepSystem::CountSleeping(&bodies[0], BODY_COUNT);
+    }
+    printf("%-14s %8.1f us/step, %6.0f bodies awake on average\n", name, total / STEP_COUNT, awake / STEP_COUNT);
+}
+
+int main(){
+    std::vector<Entity> floor(FLOOR_COUNT);
+    for (int i = 0; i < FLOOR_COUNT; i++) {
+        floor[i].entityType = PLATFORM;
+        floor[i].position = RealVec3(i, 0, 0);
+    }
+
+    std::vector<Entity> bodies(BODY_COUNT);
+    for (int i = 0; i < BODY_COUNT; i++) {
+        Entity &body = bodies[i];
+        body.entityType = PLAYER;
+        body.position = RealVec3(glm::linearRand(2.0f, FLOOR_COUNT - 2.0f), 0.95f, 0);
+        body.acceleration = RealVec3(0, -9.81f, 0);
+        body.speed = 1.5f;
+        body.width = body.height = 0.8f;
+    }
+
+    printf("%d bodies on %d floor tiles, %d driven per step\n", BODY_COUNT, FLOOR_COUNT, WINDOW_SIZE);
+    Run("always awake", bodies, floor, false);
+    Run("sleeping", bodies, floor, true);
+    return 0;
+}
@@ -0,0 +1,125 @@
+// Morton encode/decode throughput (glm/gtc/bitfield.hpp) and neighbourhood
+// queries on the Z-ordered TileGrid against a row-major grid of the same tiles.
+// Build once per ISA and compare:
+//   g++ -O2 -std=c++11 -I.. tile_bench.cpp                                  (scalar)
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. tile_bench.cpp
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -mavx2 -mbmi2 -I.. tile_bench.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <set>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/bitfield.hpp"
+#include "glm/gtc/random.hpp"
+#include "TileGrid.h"
+
+#define CODE_COUNT 65536
+#define GRID_SIZE 4096
+#define QUERY_COUNT 65536
+#define REPEAT_COUNT 50
+#define CACHE_LINE 64
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename F>
+static void Measure(const char *name, F f, std::size_t items){
+    f();
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < REPEAT_COUNT; r++) f();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    printf("%-32s %7.3f ns/item\n", name, ns / ((double)items * REPEAT_COUNT));
+}
+
+// The same queries on a plain row-major array.
+struct RowMajorGrid {
+    std::vector<glm::uint8> tiles;
+    int width, height;
+    glm::uint8 outside = 0;
+
+    RowMajorGrid(int width, int height) : tiles((size_t)width * height), width(width), height(height) {}
+
+    void Neighbourhood(int x, int y, int radius, glm::uint8 *out) const {
+        int side = 2 * radius + 1;
+        for (int dy = -radius; dy <= radius; dy++)
+            for (int dx = -radius; dx <= radius; dx++) {
+                int tx = x + dx, ty = y + dy;
+                bool inside = tx >= 0 && ty >= 0 && tx < width && ty < height;
+                out[(dy + radius) * side + dx + radius] = inside ? tiles[(size_t)ty * width + tx] : outside;
+            }
+    }
+};
+
+int main(){
+#ifdef GLM_SIMD_BMI2
+    printf("BMI2 pdep/pext: on\n\n");
+#else
+    printf("BMI2 pdep/pext: off\n\n");
+#endif
+
+    std::vector<glm::uint16> xs(CODE_COUNT), ys(CODE_COUNT);
+    std::vector<glm::uint32> codes(CODE_COUNT);
+    for (int i = 0; i < CODE_COUNT; i++) {
+        xs[i] = (glm::uint16)glm::linearRand(0, 65535);
+        ys[i] = (glm::uint16)glm::linearRand(0, 65535);
+    }
+    Measure("bitfieldInterleave loop", [&]{ for (int i = 0; i < CODE_COUNT; i++) codes[i] = glm::bitfieldInterleave(xs[i], ys[i]); }, CODE_COUNT);
+    Measure("bitfieldInterleaveArray", [&]{ glm::bitfieldInterleaveArray(&xs[0], &ys[0], &codes[0], CODE_COUNT); }, CODE_COUNT);
+    Measure("bitfieldDeinterleave loop", [&]{
+        for (int i = 0; i < CODE_COUNT; i++) { glm::u16vec2 v = glm::bitfieldDeinterleave(codes[i]); xs[i] = v.x; ys[i] = v.y; }
+    }, CODE_COUNT);
+    Measure("bitfieldDeinterleaveArray", [&]{ glm::bitfieldDeinterleaveArray(&codes[0], &xs[0], &ys[0], CODE_COUNT); }, CODE_COUNT);
+    printf("\n");
+
+    TileGrid<glm::uint8> zgrid;
+    zgrid.Init(GRID_SIZE, GRID_SIZE);
+    RowMajorGrid rgrid(GRID_SIZE, GRID_SIZE);
+    for (int y = 0; y < GRID_SIZE; y++)
+        for (int x = 0; x < GRID_SIZE; x++) {
+            glm::uint8 t = (glm::uint8)glm::linearRand(0, 255);
+            zgrid.At(x, y) = t;
+            rgrid.tiles[(size_t)y * GRID_SIZE + x] = t;
+        }
+
+    std::vector<glm::ivec2> centres(QUERY_COUNT);
+    for (int i = 0; i < QUERY_COUNT; i++) centres[i] = glm::ivec2(glm::linearRand(-2, GRID_SIZE + 1), glm::linearRand(-2, GRID_SIZE + 1));
+
+    for (int radius = 1; radius <= 2; radius++) {
+        int side = 2 * radius + 1;
+        std::vector<glm::uint8> a(side * side), b(side * side);
+
+        // Distinct cache lines each layout touches, for tiles on the grid.
+        double zLines = 0, rLines = 0;
+        int mismatches = 0;
+        for (int i = 0; i < QUERY_COUNT; i++) {
+            std::set<size_t> zSet, rSet;
+            for (int dy = -radius; dy <= radius; dy++)
+                for (int dx = -radius; dx <= radius; dx++) {
+                    int tx = centres[i].x + dx, ty = centres[i].y + dy;
+                    if (!zgrid.Contains(tx, ty)) continue;
+                    zSet.insert(zgrid.Index(tx, ty) * sizeof(glm::uint8) / CACHE_LINE);
+                    rSet.insert(((size_t)ty * GRID_SIZE + tx) * sizeof(glm::uint8) / CACHE_LINE);
+                }
+            zLines += zSet.size();
+            rLines += rSet.size();
+
+            zgrid.Neighbourhood(centres[i].x, centres[i].y, radius, &a[0]);
+            rgrid.Neighbourhood(centres[i].x, centres[i].y, radius, &b[0]);
+            if (a != b) mismatches++;
+        }
+        printf("%dx%d neighbourhood: cache lines row-major %.2f, Z order %.2f, mismatches %d\n",
+            side, side, rLines / QUERY_COUNT, zLines / QUERY_COUNT, mismatches);
+
+        glm::uint32 sum = 0;
+        Measure("  row-major", [&]{
+            for (int i = 0; i < QUERY_COUNT; i++) { rgrid.Neighbourhood(centres[i].x, centres[i].y, radius, &b[0]); sum += b[side * side / 2]; }
+        }, QUERY_COUNT);
+        Measure("  TileGrid", [&]{
+            for (int i = 0; i < QUERY_COUNT; i++) { zgrid.Neighbourhood(centres[i].x, centres[i].y, radius, &a[0]); sum += a[side * side / 2]; }
+        }, QUERY_COUNT);
+        if (sum == 1) printf("\n");
+    }
+
+    zgrid.Free();
+    return 0;
+}
@@ -0,0 +1,46 @@
+// Throughput of the batch transforms in glm/simd/matrix.h.
+// Build once per ISA and compare:
+//   g++ -O2 -std=c++11 -I.. transform_bench.cpp                                  (scalar)
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. transform_bench.cpp
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -mavx2 -I.. transform_bench.cpp
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -mavx2 -mfma -I.. transform_bench.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/simd/matrix.h"
+
+#define ITEM_COUNT 65536
+#define REPEAT_COUNT 200
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename F>
+static void Measure(const char *name, F f, std::size_t items){
+    f();
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < REPEAT_COUNT; r++) f();
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    printf("%-26s %7.3f ns/item\n", name, ns / ((double)items * REPEAT_COUNT));
+}
+
+int main(){
+    glm::mat4 m = glm::rotate(glm::translate(glm::mat4(1), glm::vec3(1, 2, 0)), 0.5f, glm::vec3(0, 0, 1));
+    const float *mp = &m[0][0];
+
+    std::vector<glm::vec4> v4(ITEM_COUNT, glm::vec4(1, 2, 3, 1)), o4(ITEM_COUNT);
+    std::vector<glm::vec3> v3(ITEM_COUNT, glm::vec3(1, 2, 3)), o3(ITEM_COUNT);
+    std::vector<glm::vec2> v2(ITEM_COUNT, glm::vec2(1, 2)), o2(ITEM_COUNT);
+    std::vector<glm::mat4> m4(ITEM_COUNT / 4, glm::mat4(2)), om(ITEM_COUNT / 4);
+
+    Measure("glm loop mat4*vec4", [&]{ for (int i = 0; i < ITEM_COUNT; i++) o4[i] = m * v4[i]; }, ITEM_COUNT);
+    Measure("mat4 x vec4[]", [&]{ glm_mat4_mul_vec4_array(mp, &v4[0][0], &o4[0][0], ITEM_COUNT); }, ITEM_COUNT);
+    Measure("mat4 x point3[]", [&]{ glm_mat4_mul_point3_array(mp, &v3[0][0], &o3[0][0], ITEM_COUNT); }, ITEM_COUNT);
+    Measure("mat4 x point2[]", [&]{ glm_mat4_mul_point2_array(mp, &v2[0][0], &o2[0][0], ITEM_COUNT); }, ITEM_COUNT);
+    Measure("glm loop mat4*mat4", [&]{ for (int i = 0; i < ITEM_COUNT / 4; i++) om[i] = m * m4[i]; }, ITEM_COUNT / 4);
+    Measure("mat4 x mat4[]", [&]{ glm_mat4_mul_mat4_array(mp, &m4[0][0][0], &om[0][0][0], ITEM_COUNT / 4); }, ITEM_COUNT / 4);
+
+    return o4[7].x + o3[7].x + o2[7].x + om[7][0][0] > 0 ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+// Accuracy and throughput of the array transcendentals in glm/gtx/fast_trigonometry.hpp
+// and glm/gtx/fast_exponential.hpp against libm. Errors are in ULP of the
+// correctly rounded float result, measured against the double libm function.
+// Build once per ISA and compare:
+//   g++ -O2 -std=c++11 -I.. trig_bench.cpp                                  (scalar)
+//   g++ -O2 -std=c++11 -DGLM_FORCE_SSE2 -I.. trig_bench.cpp
+//   g++ -O2 -std=c++11 -DGLM_FORCE_AVX2 -mavx2 -mfma -I.. trig_bench.cpp
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "glm/glm.hpp"
+#include "glm/gtc/random.hpp"
+#include "glm/gtx/fast_trigonometry.hpp"
+#include "glm/gtx/fast_exponential.hpp"
+
+#define ITEM_COUNT 65536
+#define REPEAT_COUNT 100
+#define CHECK_COUNT 4000000
+
+typedef std::chrono::high_resolution_clock Clock;
+
+template <typename F>
+static double Measure(F f){
+    f();
+    Clock::time_point start = Clock::now();
+    for (int r = 0; r < REPEAT_COUNT; r++) f();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ((double)ITEM_COUNT * REPEAT_COUNT);
+}
+
+static void Report(const char *name, double libm, double array){
+    printf("%-16s libm %6.2f ns   array %6.2f ns   x%.1f\n", name, libm, array, libm / array);
+}
+
+static double Ulp(float got, double ref){
+    if (std::isnan(ref)) return std::isnan(got) ? 0 : 1e9;
+    if (std::isinf((float)ref)) ref = (float)ref;
+    if (std::isinf(ref) || std::isinf(got)) return (double)got == ref ? 0 : 1e9;
+    int e;
+    std::frexp(ref, &e);
+    if (e < -125) e = -125;
+    return std::fabs((double)got - ref) / std::ldexp(1.0, e - 24);
+}
+
+struct Error {
+    const char *name;
+    double worst = 0;
+    float at = 0;
+    Error(const char *name) : name(name) {}
+    void Add(float got, double ref, float arg){
+        double u = Ulp(got, ref);
+        if (u > worst) { worst = u; at = arg; }
+    }
+    void Print(){ printf("%-16s max %.2f ulp (at %g)\n", name, worst, at); }
+};
+
+int main(){
+    std::vector<float> a(CHECK_COUNT), b(CHECK_COUNT), r(CHECK_COUNT), r2(CHECK_COUNT);
+
+    // sin/cos over the documented domain, plus a dense pass over one period.
+    glm::linearRandFill(glm::randomEngine(), &a[0], CHECK_COUNT / 2, -8192.0f, 8192.0f);
+    for (int i = CHECK_COUNT / 2; i < CHECK_COUNT; i++) a[i] = -3.5f + 7.0f * (float)(i - CHECK_COUNT / 2) / (CHECK_COUNT / 2);
+    glm::fastSinCosArray(&a[0], &r[0], &r2[0], CHECK_COUNT);
+    Error sinErr("fastSinArray"), cosErr("fastCosArray");
+    for (int i = 0; i < CHECK_COUNT; i++) {
+        sinErr.Add(r[i], std::sin((double)a[i]), a[i]);
+        cosErr.Add(r2[i], std::cos((double)a[i]), a[i]);
+    }
+    sinErr.Print();
+    cosErr.Print();
+
+    glm::linearRandFill(glm::randomEngine(), &a[0], CHECK_COUNT, -1000.0f, 1000.0f);
+    glm::linearRandFill(glm::randomEngine(), &b[0], CHECK_COUNT, -1000.0f, 1000.0f);
+    for (int i = 0; i < CHECK_COUNT / 4; i++) a[i] *= 1e-6f;
+    glm::fastAtan2Array(&a[0], &b[0], &r[0], CHECK_COUNT);
+    Error atanErr("fastAtan2Array");
+    for (int i = 0; i < CHECK_COUNT; i++) atanErr.Add(r[i], std::atan2((double)a[i], (double)b[i]), a[i] / b[i]);
+    atanErr.Print();
+
+    glm::linearRandFill(glm::randomEngine(), &a[0], CHECK_COUNT, -87.0f, 88.7f);
+    glm::fastExpArray(&a[0], &r[0], CHECK_COUNT);
+    Error expErr("fastExpArray");
+    for (int i = 0; i < CHECK_COUNT; i++) expErr.Add(r[i], std::exp((double)a[i]), a[i]);
+    expErr.Print();
+
+    // Every 512th positive float, denormals included.
+    int logCount = 0;
+    for (unsigned int bits = 1; bits < 0x7f800000u && logCount < CHECK_COUNT; bits += 512, logCount++)
+        std::memcpy(&a[logCount], &bits, sizeof(float));
+    glm::fastLogArray(&a[0], &r[0], logCount);
+    Error logErr("fastLogArray");
+    for (int i = 0; i < logCount; i++) logErr.Add(r[i], std::log((double)a[i]), a[i]);
+    logErr.Print();
+
+    // Edge cases against the float libm functions.
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float edges[] = { 0.0f, -0.0f, 1.0f, -1.0f, inf, -inf, nan, 1e-45f, 3.4e38f, -3.4e38f, 100.0f, -100.0f };
+    const int edgeCount = sizeof(edges) / sizeof(edges[0]);
+    int mismatches = 0;
+    for (int i = 0; i < edgeCount; i++) {
+        float s, c, e, l;
+        glm::fastSinCosArray(&edges[i], &s, &c, 1);
+        glm::fastExpArray(&edges[i], &e, 1);
+        glm::fastLogArray(&edges[i], &l, 1);
+        if (std::fabs(edges[i]) <= 8192.0f || !std::isfinite(edges[i])) {
+            if (Ulp(s, std::sin((double)edges[i])) > 4 || (s == 0 && std::signbit(s) != std::signbit(edges[i]))) mismatches++;
+            if (Ulp(c, std::cos((double)edges[i])) > 4) mismatches++;
+        }
+        if (Ulp(e, std::exp((double)edges[i])) > 4) mismatches++;
+        if (Ulp(l, std::log((double)edges[i])) > 4) mismatches++;
+        for (int j = 0; j < edgeCount; j++) {
+            float t;
+            glm::fastAtan2Array(&edges[i], &edges[j], &t, 1);
+            double ref = std::atan2((double)edges[i], (double)edges[j]);
+            if (Ulp(t, ref) > 4 || (!std::isnan(ref) && std::signbit(t) != std::signbit(ref))) mismatches++;
+        }
+    }
+    printf("edge case mismatches: %d\n\n", mismatches);
+
+    glm::linearRandFill(glm::randomEngine(), &a[0], ITEM_COUNT, -80.0f, 80.0f);
+    glm::linearRandFill(glm::randomEngine(), &b[0], ITEM_COUNT, -80.0f, 80.0f);
+    Report("sin", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) r[i] = std::sin(a[i]); }),
+        Measure([&]{ glm::fastSinArray(&a[0], &r[0], ITEM_COUNT); }));
+    Report("cos", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) r[i] = std::cos(a[i]); }),
+        Measure([&]{ glm::fastCosArray(&a[0], &r[0], ITEM_COUNT); }));
+    Report("sin+cos", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) { r[i] = std::sin(a[i]); r2[i] = std::cos(a[i]); } }),
+        Measure([&]{ glm::fastSinCosArray(&a[0], &r[0], &r2[0], ITEM_COUNT); }));
+    Report("atan2", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) r[i] = std::atan2(a[i], b[i]); }),
+        Measure([&]{ glm::fastAtan2Array(&a[0], &b[0], &r[0], ITEM_COUNT); }));
+    Report("exp", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) r[i] = std::exp(a[i]); }),
+        Measure([&]{ glm::fastExpArray(&a[0], &r[0], ITEM_COUNT); }));
+    for (int i = 0; i < ITEM_COUNT; i++) b[i] = std::fabs(b[i]) + 1e-3f;
+    Report("log", Measure([&]{ for (int i = 0; i < ITEM_COUNT; i++) r[i] = std::log(b[i]); }),
+        Measure([&]{ glm::fastLogArray(&b[0], &r[0], ITEM_COUNT); }));
+    return 0;
+}
@@ -89,7 +89,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, qua<float, Q> const& p)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_sub_ps(q.data, p.data);
 			return Result;
 		}
@@ -113,7 +113,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, float s)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_mul_ps(q.data, _mm_set_ps1(s));
 			return Result;
 		}
@@ -126,7 +126,7 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_mul_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_mul_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
@@ -137,7 +137,7 @@ namespace detail
 	{
 		static qua<float, Q> call(qua<float, Q> const& q, float s)
 		{
-			vec<4, float, Q> Result;
+			qua<float, Q> Result;
 			Result.data = _mm_div_ps(q.data, _mm_set_ps1(s));
 			return Result;
 		}
@@ -150,7 +150,7 @@ namespace detail
 		static qua<double, Q> call(qua<double, Q> const& q, double s)
 		{
 			qua<double, Q> Result;
-			Result.data = _mm256_div_pd(q.data, _mm_set_ps1(s));
+			Result.data = _mm256_div_pd(q.data, _mm256_set1_pd(s));
 			return Result;
 		}
 	};
@@ -177,10 +177,54 @@ namespace detail
 			uuv = _mm_mul_ps(uuv, two);
 
 			vec<4, float, Q> Result;
-			Result.data = _mm_add_ps(v.Data, _mm_add_ps(uv, uuv));
+			Result.data = _mm_add_ps(v.data, _mm_add_ps(uv, uuv));
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_quat_mul_vec4<double, Q, true>
+	{
+		// AVX has no cross-lane double shuffle; AVX2 has vpermpd.
+		static __m256d swp0(__m256d v)
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 0, 2, 1));
+#			else
+				__m256d const t = _mm256_permute2f128_pd(v, v, 0x01);
+				return _mm256_blend_pd(_mm256_shuffle_pd(v, t, 0x9), _mm256_shuffle_pd(t, v, 0x9), 0xC);
+#			endif
+		}
+
+		static __m256d swp1(__m256d v)
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 1, 0, 2));
+#			else
+				return _mm256_shuffle_pd(_mm256_permute2f128_pd(v, v, 0x01), v, 0xC);
+#			endif
+		}
+
+		static vec<4, double, Q> call(qua<double, Q> const& q, vec<4, double, Q> const& v)
+		{
+			__m256d const q_wwww = _mm256_permute_pd(_mm256_permute2f128_pd(q.data, q.data, 0x11), 0xF);
+			__m256d const q_swp0 = swp0(q.data);
+			__m256d const q_swp1 = swp1(q.data);
+
+			__m256d uv  = _mm256_sub_pd(_mm256_mul_pd(q_swp0, swp1(v.data)), _mm256_mul_pd(q_swp1, swp0(v.data)));
+			__m256d uuv = _mm256_sub_pd(_mm256_mul_pd(q_swp0, swp1(uv)), _mm256_mul_pd(q_swp1, swp0(uv)));
+
+			__m256d const two = _mm256_set1_pd(2.0);
+			uv  = _mm256_mul_pd(uv, _mm256_mul_pd(q_wwww, two));
+			uuv = _mm256_mul_pd(uuv, two);
+
+			vec<4, double, Q> Result;
+			Result.data = _mm256_add_pd(v.data, _mm256_add_pd(uv, uuv));
 			return Result;
 		}
 	};
+#	endif
 }//namespace detail
 }//namespace glm
 
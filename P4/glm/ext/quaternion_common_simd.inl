@@ -11,6 +11,20 @@ namespace detail
 			return _mm_cvtss_f32(glm_vec1_dot(x.data, y.data));
 		}
 	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_dot<qua<double, Q>, double, true>
+	{
+		static GLM_FUNC_QUALIFIER double call(qua<double, Q> const& x, qua<double, Q> const& y)
+		{
+			__m256d const mul0 = _mm256_mul_pd(x.data, y.data);
+			__m128d const add0 = _mm_add_pd(_mm256_castpd256_pd128(mul0), _mm256_extractf128_pd(mul0, 1));
+			__m128d const add1 = _mm_add_sd(add0, _mm_unpackhi_pd(add0, add0));
+			return _mm_cvtsd_f64(add1);
+		}
+	};
+#	endif
 }//namespace detail
 }//namespace glm
 
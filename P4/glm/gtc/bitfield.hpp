@@ -21,6 +21,7 @@
 #include "../detail/qualifier.hpp"
 #include "../detail/_vectorize.hpp"
 #include "type_precision.hpp"
+#include <cstddef>
 #include <limits>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
@@ -260,6 +261,28 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w);
 
+	/// Writes bitfieldInterleave(x[i], y[i]) to out[i], the Morton code of each
+	/// coordinate pair. Uses BMI2 pdep where GLM_SIMD_BMI2 is set and several
+	/// pairs per instruction on SSE2 otherwise.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldInterleaveArray(uint16 const* x, uint16 const* y, uint32* out, std::size_t count);
+
+	/// Writes bitfieldInterleave(x[i], y[i]) to out[i].
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldInterleaveArray(uint32 const* x, uint32 const* y, uint64* out, std::size_t count);
+
+	/// Splits each Morton code in[i] back into x[i] and y[i], the inverse of bitfieldInterleaveArray.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleaveArray(uint32 const* in, uint16* x, uint16* y, std::size_t count);
+
+	/// Splits each Morton code in[i] back into x[i] and y[i].
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DECL void bitfieldDeinterleaveArray(uint64 const* in, uint32* x, uint32* y, std::size_t count);
+
 	/// @}
 } //namespace glm
 
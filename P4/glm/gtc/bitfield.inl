@@ -14,6 +14,57 @@ namespace detail
 	template<typename PARAM, typename RET>
 	GLM_FUNC_DECL RET bitfieldInterleave(PARAM x, PARAM y, PARAM z, PARAM w);
 
+#	ifdef GLM_SIMD_BMI2
+	// One pdep per component deposits its bits straight into the mask the shift
+	// and mask cascades below end with.
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
+	{
+		return static_cast<glm::uint16>(_pdep_u32(x, 0x5555u) | _pdep_u32(y, 0xAAAAu));
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint16 x, glm::uint16 y)
+	{
+		return _pdep_u32(x, 0x55555555u) | _pdep_u32(y, 0xAAAAAAAAu);
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y)
+	{
+		return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z)
+	{
+		return _pdep_u32(x, 0x49249249u) | _pdep_u32(y, 0x92492492u) | _pdep_u32(z, 0x24924924u);
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z)
+	{
+		return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y, glm::uint32 z)
+	{
+		return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z, glm::uint8 w)
+	{
+		return _pdep_u32(x, 0x11111111u) | _pdep_u32(y, 0x22222222u) | _pdep_u32(z, 0x44444444u) | _pdep_u32(w, 0x88888888u);
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z, glm::uint16 w)
+	{
+		return _pdep_u64(x, 0x1111111111111111ull) | _pdep_u64(y, 0x2222222222222222ull) | _pdep_u64(z, 0x4444444444444444ull) | _pdep_u64(w, 0x8888888888888888ull);
+	}
+#	else
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
 	{
@@ -219,6 +270,7 @@ namespace detail
 
 		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
 	}
+#	endif//GLM_SIMD_BMI2
 }//namespace detail
 
 	template<typename genIUType>
@@ -328,6 +380,12 @@ namespace detail
 		return detail::bitfieldInterleave<uint8, uint16>(v.x, v.y);
 	}
 
+#	ifdef GLM_SIMD_BMI2
+	GLM_FUNC_QUALIFIER u8vec2 bitfieldDeinterleave(glm::uint16 x)
+	{
+		return u8vec2(_pext_u32(x, 0x5555u), _pext_u32(x, 0xAAAAu));
+	}
+#	else
 	GLM_FUNC_QUALIFIER u8vec2 bitfieldDeinterleave(glm::uint16 x)
 	{
 		uint16 REG1(x);
@@ -350,6 +408,7 @@ namespace detail
 
 		return glm::u8vec2(REG1, REG2);
 	}
+#	endif//GLM_SIMD_BMI2
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int16 x, int16 y)
 	{
@@ -382,6 +441,12 @@ namespace detail
 		return detail::bitfieldInterleave<uint16, uint32>(v.x, v.y);
 	}
 
+#	ifdef GLM_SIMD_BMI2
+	GLM_FUNC_QUALIFIER glm::u16vec2 bitfieldDeinterleave(glm::uint32 x)
+	{
+		return glm::u16vec2(_pext_u32(x, 0x55555555u), _pext_u32(x, 0xAAAAAAAAu));
+	}
+#	else
 	GLM_FUNC_QUALIFIER glm::u16vec2 bitfieldDeinterleave(glm::uint32 x)
 	{
 		glm::uint32 REG1(x);
@@ -404,6 +469,7 @@ namespace detail
 
 		return glm::u16vec2(REG1, REG2);
 	}
+#	endif//GLM_SIMD_BMI2
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int32 x, int32 y)
 	{
@@ -436,6 +502,12 @@ namespace detail
 		return detail::bitfieldInterleave<uint32, uint64>(v.x, v.y);
 	}
 
+#	ifdef GLM_SIMD_BMI2
+	GLM_FUNC_QUALIFIER glm::u32vec2 bitfieldDeinterleave(glm::uint64 x)
+	{
+		return glm::u32vec2(_pext_u64(x, 0x5555555555555555ull), _pext_u64(x, 0xAAAAAAAAAAAAAAAAull));
+	}
+#	else
 	GLM_FUNC_QUALIFIER glm::u32vec2 bitfieldDeinterleave(glm::uint64 x)
 	{
 		glm::uint64 REG1(x);
@@ -461,6 +533,7 @@ namespace detail
 
 		return glm::u32vec2(REG1, REG2);
 	}
+#	endif//GLM_SIMD_BMI2
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int8 x, int8 y, int8 z)
 	{
@@ -623,4 +696,64 @@ namespace detail
 	{
 		return detail::bitfieldInterleave<uint16, uint64>(v.x, v.y, v.z, v.w);
 	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(uint16 const* x, uint16 const* y, uint32* out, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(GLM_SIMD_BMI2)
+			glm_uvec4 const Zero = _mm_setzero_si128();
+			for(; i < count / 8 * 8; i += 8)
+			{
+				glm_uvec4 const vx = _mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(x + i));
+				glm_uvec4 const vy = _mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(y + i));
+				_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(out + i), glm_u32vec4_interleave16(_mm_unpacklo_epi16(vx, Zero), _mm_unpacklo_epi16(vy, Zero)));
+				_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(out + i + 4), glm_u32vec4_interleave16(_mm_unpackhi_epi16(vx, Zero), _mm_unpackhi_epi16(vy, Zero)));
+			}
+#		endif
+		for(; i < count; ++i)
+			out[i] = detail::bitfieldInterleave<uint16, uint32>(x[i], y[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleaveArray(uint32 const* x, uint32 const* y, uint64* out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+			out[i] = detail::bitfieldInterleave<uint32, uint64>(x[i], y[i]);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint32 const* in, uint16* x, uint16* y, std::size_t count)
+	{
+		std::size_t i = 0;
+#		if (GLM_ARCH & GLM_ARCH_SSE2_BIT) && !defined(GLM_SIMD_BMI2)
+			for(; i < count / 8 * 8; i += 8)
+			{
+				glm_uvec4 x0, y0, x1, y1;
+				glm_u32vec4_deinterleave16(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(in + i)), x0, y0);
+				glm_u32vec4_deinterleave16(_mm_loadu_si128(reinterpret_cast<glm_uvec4 const*>(in + i + 4)), x1, y1);
+
+				// SSE2 only packs with signed saturation; sign extend the 16-bit values first.
+				x0 = _mm_srai_epi32(_mm_slli_epi32(x0, 16), 16);
+				x1 = _mm_srai_epi32(_mm_slli_epi32(x1, 16), 16);
+				y0 = _mm_srai_epi32(_mm_slli_epi32(y0, 16), 16);
+				y1 = _mm_srai_epi32(_mm_slli_epi32(y1, 16), 16);
+				_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(x + i), _mm_packs_epi32(x0, x1));
+				_mm_storeu_si128(reinterpret_cast<glm_uvec4*>(y + i), _mm_packs_epi32(y0, y1));
+			}
+#		endif
+		for(; i < count; ++i)
+		{
+			u16vec2 const v = bitfieldDeinterleave(in[i]);
+			x[i] = v.x;
+			y[i] = v.y;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleaveArray(uint64 const* in, uint32* x, uint32* y, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			u32vec2 const v = bitfieldDeinterleave(in[i]);
+			x[i] = v.x;
+			y[i] = v.y;
+		}
+	}
 }//namespace glm
@@ -5,6 +5,12 @@
 // Following Stefan Gustavson's paper "Simplex noise demystified":
 // http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
 
+#include "../detail/_lanes.hpp"
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <thread>
+#	include <vector>
+#endif
+
 namespace glm{
 namespace gtc
 {
@@ -804,4 +810,237 @@ namespace gtc
 			(dot(m0 * m0, vec<3, T, Q>(dot(p0, x0), dot(p1, x1), dot(p2, x2))) +
 			dot(m1 * m1, vec<2, T, Q>(dot(p3, x3), dot(p4, x4))));
 	}
+
+namespace detail
+{
+	// The batch functions run the vec2 perlin and simplex code on the lane
+	// types from detail/_lanes.hpp, one point per lane. Each lane does the same
+	// float operations in the same order as the single point versions.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_fract(V const& x)
+	{
+		return x - lane_floor(x);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_mod(V const& x, float y)
+	{
+		return x - V(y) * lane_floor(x / V(y));
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_permute(V const& x)
+	{
+		V const y = ((x * V(34.0f)) + V(1.0f)) * x;
+		return y - lane_floor(y * V(1.0f / 289.0f)) * V(289.0f);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V perlin_corner(V const& i, V const& fx, V const& fy)
+	{
+		V gx = V(2.0f) * noise_fract(i / V(41.0f)) - V(1.0f);
+		V const gy = lane_abs(gx) - V(0.5f);
+		V const tx = lane_floor(gx + V(0.5f));
+		gx = gx - tx;
+
+		V const norm = V(1.79284291400159f) - V(0.85373472095314f) * (gx * gx + gy * gy);
+		return (gx * norm) * fx + (gy * norm) * fy;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V noise_mix(V const& x, V const& y, V const& a)
+	{
+		return x * (V(1.0f) - a) + y * a;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V perlin_lanes(V const& x, V const& y)
+	{
+		V const x0 = lane_floor(x);
+		V const y0 = lane_floor(y);
+		V const Pix = noise_mod(x0, 289.0f);
+		V const Piy = noise_mod(y0, 289.0f);
+		V const Piz = noise_mod(x0 + V(1.0f), 289.0f);
+		V const Piw = noise_mod(y0 + V(1.0f), 289.0f);
+		V const Pfx = noise_fract(x);
+		V const Pfy = noise_fract(y);
+		V const Pfz = Pfx - V(1.0f);
+		V const Pfw = Pfy - V(1.0f);
+
+		V const px0 = noise_permute(Pix);
+		V const px1 = noise_permute(Piz);
+
+		V const n00 = perlin_corner(noise_permute(px0 + Piy), Pfx, Pfy);
+		V const n10 = perlin_corner(noise_permute(px1 + Piy), Pfz, Pfy);
+		V const n01 = perlin_corner(noise_permute(px0 + Piw), Pfx, Pfw);
+		V const n11 = perlin_corner(noise_permute(px1 + Piw), Pfz, Pfw);
+
+		V const fade_x = (Pfx * Pfx * Pfx) * (Pfx * (Pfx * V(6.0f) - V(15.0f)) + V(10.0f));
+		V const fade_y = (Pfy * Pfy * Pfy) * (Pfy * (Pfy * V(6.0f) - V(15.0f)) + V(10.0f));
+		V const n_x0 = noise_mix(n00, n10, fade_x);
+		V const n_x1 = noise_mix(n01, n11, fade_x);
+		return V(2.3f) * noise_mix(n_x0, n_x1, fade_y);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V simplex_corner(V const& p, V const& x, V const& y)
+	{
+		V const gx = V(2.0f) * noise_fract(p * V(0.024390243902439f)) - V(1.0f);
+		V const h = lane_abs(gx) - V(0.5f);
+		V const ox = lane_floor(gx + V(0.5f));
+		V const a0 = gx - ox;
+
+		V m = lane_max(V(0.5f) - (x * x + y * y), V(0.0f));
+		m = m * m;
+		m = m * m;
+		m = m * (V(1.79284291400159f) - V(0.85373472095314f) * (a0 * a0 + h * h));
+		return m * (a0 * x + h * y);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V simplex_lanes(V const& x, V const& y)
+	{
+		V const Cx(0.211324865405187f);
+		V const Cy(0.366025403784439f);
+		V const Cz(-0.577350269189626f);
+
+		// First corner
+		V const s = x * Cy + y * Cy;
+		V ix = lane_floor(x + s);
+		V iy = lane_floor(y + s);
+		V const t = ix * Cx + iy * Cx;
+		V const x0 = x - ix + t;
+		V const y0 = y - iy + t;
+
+		// Other corners
+		V const i1x = lane_select(lane_gt(x0, y0), V(1.0f), V(0.0f));
+		V const i1y = V(1.0f) - i1x;
+		V const x1 = (x0 + Cx) - i1x;
+		V const y1 = (y0 + Cx) - i1y;
+		V const x2 = x0 + Cz;
+		V const y2 = y0 + Cz;
+
+		// Permutations
+		ix = noise_mod(ix, 289.0f);
+		iy = noise_mod(iy, 289.0f);
+		V const p0 = noise_permute(noise_permute(iy) + ix);
+		V const p1 = noise_permute(noise_permute(iy + i1y) + ix + i1x);
+		V const p2 = noise_permute(noise_permute(iy + V(1.0f)) + ix + V(1.0f));
+
+		V const g0 = simplex_corner(p0, x0, y0);
+		V const g1 = simplex_corner(p1, x1, y1);
+		V const g2 = simplex_corner(p2, x2, y2);
+		return V(130.0f) * (g0 + g1 + g2);
+	}
+
+	typedef lanes (*noise_func)(lanes const&, lanes const&);
+
+	GLM_FUNC_QUALIFIER void noise_array(noise_func func, float const* xy, float* out, std::size_t count)
+	{
+		std::size_t const N = lane_count;
+		float x[N], y[N], r[N];
+		for(std::size_t i = 0; i < count; i += N)
+		{
+			// The tail is padded with copies of the last point.
+			for(std::size_t j = 0; j < N; ++j)
+			{
+				std::size_t const k = i + j < count ? i + j : count - 1;
+				x[j] = xy[k * 2 + 0];
+				y[j] = xy[k * 2 + 1];
+			}
+			lane_store(r, func(lane_load<lanes>(x), lane_load<lanes>(y)));
+			for(std::size_t j = 0; j < N && i + j < count; ++j)
+				out[i + j] = r[j];
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void noise_grid_rows(
+		noise_func func, float* out, int width, int rowBegin, int rowEnd,
+		vec<2, float, defaultp> const& origin, vec<2, float, defaultp> const& step,
+		int octaves, float lacunarity, float gain)
+	{
+		int const N = static_cast<int>(lane_count);
+		float x[lane_count], r[lane_count];
+		for(int row = rowBegin; row < rowEnd; ++row)
+		{
+			float* dst = out + static_cast<std::size_t>(row) * static_cast<std::size_t>(width);
+			for(int col = 0; col < width; ++col)
+				dst[col] = 0.0f;
+
+			float frequency = 1.0f;
+			float amplitude = 1.0f;
+			for(int octave = 0; octave < octaves; ++octave)
+			{
+				lanes const y((origin.y + static_cast<float>(row) * step.y) * frequency);
+				for(int col = 0; col < width; col += N)
+				{
+					for(int j = 0; j < N; ++j)
+					{
+						int const c = col + j < width ? col + j : width - 1;
+						x[j] = (origin.x + static_cast<float>(c) * step.x) * frequency;
+					}
+					lane_store(r, func(lane_load<lanes>(x), y));
+					for(int j = 0; j < N && col + j < width; ++j)
+						dst[col + j] += r[j] * amplitude;
+				}
+				frequency *= lacunarity;
+				amplitude *= gain;
+			}
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void noise_grid(
+		noise_func func, float* out, int width, int height,
+		vec<2, float, defaultp> const& origin, vec<2, float, defaultp> const& step,
+		int octaves, float lacunarity, float gain, int threads)
+	{
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			if(threads > height)
+				threads = height;
+			if(threads > 1)
+			{
+				std::vector<std::thread> workers;
+				int const band = (height + threads - 1) / threads;
+				for(int begin = band; begin < height; begin += band)
+				{
+					int const end = begin + band < height ? begin + band : height;
+					workers.push_back(std::thread(noise_grid_rows, func, out, width, begin, end, origin, step, octaves, lacunarity, gain));
+				}
+				noise_grid_rows(func, out, width, 0, band, origin, step, octaves, lacunarity, gain);
+				for(std::size_t i = 0; i < workers.size(); ++i)
+					workers[i].join();
+				return;
+			}
+#		else
+			static_cast<void>(threads);
+#		endif
+		noise_grid_rows(func, out, width, 0, height, origin, step, octaves, lacunarity, gain);
+	}
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER void perlinArray(float const* xy, float* out, std::size_t count)
+	{
+		detail::noise_array(detail::perlin_lanes<detail::lanes>, xy, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexArray(float const* xy, float* out, std::size_t count)
+	{
+		detail::noise_array(detail::simplex_lanes<detail::lanes>, xy, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void perlinGrid(
+		float* out, int width, int height,
+		vec<2, float, defaultp> const& origin, vec<2, float, defaultp> const& step,
+		int octaves, float lacunarity, float gain, int threads)
+	{
+		detail::noise_grid(detail::perlin_lanes<detail::lanes>, out, width, height, origin, step, octaves, lacunarity, gain, threads);
+	}
+
+	GLM_FUNC_QUALIFIER void simplexGrid(
+		float* out, int width, int height,
+		vec<2, float, defaultp> const& origin, vec<2, float, defaultp> const& step,
+		int octaves, float lacunarity, float gain, int threads)
+	{
+		detail::noise_grid(detail::simplex_lanes<detail::lanes>, out, width, height, origin, step, octaves, lacunarity, gain, threads);
+	}
 }//namespace glm
@@ -15,6 +15,7 @@
 
 // Dependency:
 #include "type_precision.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -511,6 +512,22 @@ namespace glm
 	template<length_t L, qualifier Q>
 	GLM_FUNC_DECL vec<L, float, Q> unpackHalf(vec<L, uint16, Q> const& p);
 
+	/// Converts count floats to half floats with IEEE round to nearest even, bit exact with F16C.
+	/// Overflow gives infinity and NaNs stay NaN, keeping their sign and top payload bits.
+	/// Unlike packHalf1x16, ties round to even rather than away from zero.
+	/// Uses F16C when GLM_SIMD_F16C is defined (-mf16c), SSE2 otherwise.
+	///
+	/// @see gtc_packing
+	/// @see void unpackHalfArray(uint16 const* in, float* out, std::size_t count)
+	GLM_FUNC_DECL void packHalfArray(float const* in, uint16* out, std::size_t count);
+
+	/// Converts count half floats to floats. The conversion is exact; NaN payloads are kept and quieted, as F16C does.
+	/// Uses F16C when GLM_SIMD_F16C is defined (-mf16c), SSE2 otherwise.
+	///
+	/// @see gtc_packing
+	/// @see void packHalfArray(float const* in, uint16* out, std::size_t count)
+	GLM_FUNC_DECL void unpackHalfArray(uint16 const* in, float* out, std::size_t count);
+
 	/// Convert each component of the normalized floating-point vector into unsigned integer values.
 	///
 	/// @see gtc_packing
@@ -350,6 +350,57 @@ namespace detail
 			return vec<4, float, Q>(detail::toFloat32(v.x), detail::toFloat32(v.y), detail::toFloat32(v.z), detail::toFloat32(v.w));
 		}
 	};
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	GLM_FUNC_QUALIFIER __m128i select_epi32(__m128i mask, __m128i a, __m128i b)
+	{
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+
+	// SSE2 version of toFloat16RoundEven, returns one half per 32-bit lane.
+	GLM_FUNC_QUALIFIER __m128i pack_half4(__m128 f)
+	{
+		__m128i const bits = _mm_castps_si128(f);
+		__m128i const sign = _mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+		__m128i const u = _mm_xor_si128(bits, sign);
+
+		__m128i const odd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+		__m128i const nrm = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(static_cast<int>(0xc8000fffu))), odd), 13);
+
+		__m128i const magic = _mm_set1_epi32(0x3f000000);
+		__m128i const den = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_castsi128_ps(magic))), magic);
+
+		__m128i const nan = _mm_or_si128(_mm_set1_epi32(0x7e00), _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(0x3ff)));
+		__m128i const infnan = select_epi32(_mm_cmpgt_epi32(u, _mm_set1_epi32(0x7f800000)), nan, _mm_set1_epi32(0x7c00));
+
+		__m128i const isinfnan = _mm_cmpgt_epi32(u, _mm_set1_epi32(0x477fffff));
+		__m128i const isden = _mm_cmplt_epi32(u, _mm_set1_epi32(0x38800000));
+		__m128i const h = select_epi32(isinfnan, infnan, select_epi32(isden, den, nrm));
+		return _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+	}
+
+	// Packs two vectors of halves in 32-bit lanes into eight 16-bit lanes.
+	GLM_FUNC_QUALIFIER __m128i pack_half8(__m128i a, __m128i b)
+	{
+		// Sign extend so the signed saturation of packs leaves the bits alone.
+		a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+		b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+		return _mm_packs_epi32(a, b);
+	}
+
+	// Four halves in the low 16 bits of each 32-bit lane to floats. Scaling by
+	// 2^112 rebiases the exponent and normalizes denormals in one multiply.
+	// Signaling NaNs are quieted, as F16C does.
+	GLM_FUNC_QUALIFIER __m128 unpack_half4(__m128i h)
+	{
+		__m128i const expmant = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+		__m128i const sign = _mm_slli_epi32(_mm_xor_si128(h, expmant), 16);
+		__m128 const scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expmant, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+		__m128i const infnan = _mm_and_si128(_mm_cmpgt_epi32(expmant, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23));
+		__m128i const quiet = _mm_and_si128(_mm_cmpgt_epi32(expmant, _mm_set1_epi32(0x7c00)), _mm_set1_epi32(0x00400000));
+		return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, _mm_or_si128(infnan, quiet))));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
 }//namespace detail
 
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
@@ -668,6 +719,63 @@ namespace detail
 		return detail::compute_half<L, Q>::unpack(v);
 	}
 
+	GLM_FUNC_QUALIFIER void packHalfArray(float const* in, uint16* out, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#		if defined(GLM_SIMD_F16C)
+			for(; i < count / 8 * 8; i += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+			for(; i < count / 4 * 4; i += 4)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_cvtps_ph(_mm_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			for(; i < count / 8 * 8; i += 8)
+			{
+				__m128i const a = detail::pack_half4(_mm_loadu_ps(in + i));
+				__m128i const b = detail::pack_half4(_mm_loadu_ps(in + i + 4));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), detail::pack_half8(a, b));
+			}
+			for(; i < count / 4 * 4; i += 4)
+			{
+				__m128i const a = detail::pack_half4(_mm_loadu_ps(in + i));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), detail::pack_half8(a, a));
+			}
+#		endif
+
+		for(; i < count; ++i)
+			out[i] = static_cast<uint16>(detail::toFloat16RoundEven(in[i]));
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalfArray(uint16 const* in, float* out, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#		if defined(GLM_SIMD_F16C)
+			for(; i < count / 8 * 8; i += 8)
+				_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i))));
+			for(; i < count / 4 * 4; i += 4)
+				_mm_storeu_ps(out + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(in + i))));
+#		elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128i const zero = _mm_setzero_si128();
+			for(; i < count / 8 * 8; i += 8)
+			{
+				__m128i const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+				_mm_storeu_ps(out + i, detail::unpack_half4(_mm_unpacklo_epi16(h, zero)));
+				_mm_storeu_ps(out + i + 4, detail::unpack_half4(_mm_unpackhi_epi16(h, zero)));
+			}
+			for(; i < count / 4 * 4; i += 4)
+				_mm_storeu_ps(out + i, detail::unpack_half4(_mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(in + i)), zero)));
+#		endif
+
+		for(; i < count; ++i)
+		{
+			detail::uif32 Result(detail::toFloat32(static_cast<detail::hdata>(in[i])));
+			if((in[i] & 0x7fff) > 0x7c00)
+				Result.i |= 0x00400000u;
+			out[i] = Result.f;
+		}
+	}
+
 	template<typename uintType, length_t L, typename floatType, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, uintType, Q> packUnorm(vec<L, floatType, Q> const& v)
 	{
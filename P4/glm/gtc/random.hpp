@@ -17,6 +17,7 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -76,6 +77,55 @@ namespace glm
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// xoshiro256++ pseudo random number generator.
+	///
+	/// 32 bytes of state, no locking and much better quality than std::rand.
+	/// Any type providing `uint64 operator()()` can be used where an engine is expected.
+	///
+	/// @see gtc_random
+	struct xoshiro256pp
+	{
+		uint64 s[4];
+
+		GLM_FUNC_DECL explicit xoshiro256pp(uint64 Seed = 0x853c49e6748fea9bULL);
+
+		/// Resets the state from a single 64 bit seed using splitmix64.
+		GLM_FUNC_DECL void seed(uint64 Seed);
+
+		GLM_FUNC_DECL uint64 operator()();
+
+		/// Advances the state by 2^128 calls. Use it to give each thread a non-overlapping stream.
+		GLM_FUNC_DECL void jump();
+	};
+
+	/// Engine used by linearRand, gaussRand and the other functions of this extension.
+	/// Each thread owns its own engine (when C++11 thread_local is available), so threads never contend.
+	/// Until seeded, the first thread to draw uses the default seed and each later one starts
+	/// jump() further along that stream, so no two threads produce the same numbers.
+	/// Define GLM_FORCE_STD_RAND to go back to std::rand.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL xoshiro256pp& randomEngine();
+
+	/// Seeds the calling thread's engine.
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL void seedRandom(uint64 Seed);
+
+	/// Fills Out[0, Count) with numbers in the interval [Min, Max), according a linear distribution.
+	/// Uses SSE2 when available; results are the same with or without SIMD.
+	///
+	/// @param Engine Generator to draw from, e.g. xoshiro256pp or randomEngine()
+	/// @see gtc_random
+	template<typename engine>
+	GLM_FUNC_DECL void linearRandFill(engine& Engine, float* Out, std::size_t Count, float Min, float Max);
+
+	/// Fills Out[0, Count) with vectors in the interval [Min, Max), according a linear distribution.
+	///
+	/// @see gtc_random
+	template<typename engine, length_t L, qualifier Q>
+	GLM_FUNC_DECL void linearRandFill(engine& Engine, vec<L, float, Q>* Out, std::size_t Count, vec<L, float, Q> const& Min, vec<L, float, Q> const& Max);
+
 	/// @}
 }//namespace glm
 
@@ -6,6 +6,10 @@
 #include <ctime>
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#if GLM_LANG & GLM_LANG_CXX11_FLAG
+#	include <atomic>
+#endif
 
 namespace glm{
 namespace detail
@@ -16,6 +20,7 @@ namespace detail
 		GLM_FUNC_QUALIFIER static vec<L, T, Q> call();
 	};
 
+#	ifdef GLM_FORCE_STD_RAND
 	template <qualifier P>
 	struct compute_rand<1, uint8, P>
 	{
@@ -62,6 +67,51 @@ namespace detail
 		}
 	};
 
+#	else
+	// Each uint8/uint16/uint32 component takes the high bits of one engine call,
+	// instead of assembling bytes from several std::rand() calls.
+	template <length_t L, qualifier Q>
+	struct compute_rand<L, uint64, Q>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call()
+		{
+			xoshiro256pp& Engine = randomEngine();
+			vec<L, uint64, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = Engine();
+			return Result;
+		}
+	};
+
+	template <length_t L, qualifier Q>
+	struct compute_rand<L, uint32, Q>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call()
+		{
+			return vec<L, uint32, Q>(compute_rand<L, uint64, Q>::call() >> static_cast<uint64>(32));
+		}
+	};
+
+	template <length_t L, qualifier Q>
+	struct compute_rand<L, uint16, Q>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call()
+		{
+			return vec<L, uint16, Q>(compute_rand<L, uint64, Q>::call() >> static_cast<uint64>(48));
+		}
+	};
+
+	template <length_t L, qualifier Q>
+	struct compute_rand<L, uint8, Q>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call()
+		{
+			return vec<L, uint8, Q>(compute_rand<L, uint64, Q>::call() >> static_cast<uint64>(56));
+		}
+	};
+#	endif//GLM_FORCE_STD_RAND
+
+#	ifdef GLM_FORCE_STD_RAND
 	template <length_t L, qualifier Q>
 	struct compute_rand<L, uint16, Q>
 	{
@@ -94,6 +144,7 @@ namespace detail
 				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call()) << static_cast<uint64>(0));
 		}
 	};
+#	endif//GLM_FORCE_STD_RAND
 
 	template <length_t L, typename T, qualifier Q>
 	struct compute_linearRand
@@ -300,4 +351,155 @@ namespace detail
 
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
+
+	GLM_FUNC_QUALIFIER xoshiro256pp::xoshiro256pp(uint64 Seed)
+	{
+		seed(Seed);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp::seed(uint64 Seed)
+	{
+		for(int i = 0; i < 4; ++i)
+		{
+			uint64 z = (Seed += 0x9e3779b97f4a7c15ULL);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			s[i] = z ^ (z >> 31);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER uint64 xoshiro256pp::operator()()
+	{
+		uint64 const Sum = s[0] + s[3];
+		uint64 const Result = ((Sum << 23) | (Sum >> 41)) + s[0];
+		uint64 const t = s[1] << 17;
+
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = (s[3] << 45) | (s[3] >> 19);
+
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro256pp::jump()
+	{
+		static const uint64 Jump[] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+
+		uint64 t[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; ++i)
+		for(int b = 0; b < 64; ++b)
+		{
+			if(Jump[i] & (static_cast<uint64>(1) << b))
+			{
+				t[0] ^= s[0];
+				t[1] ^= s[1];
+				t[2] ^= s[2];
+				t[3] ^= s[3];
+			}
+			(*this)();
+		}
+
+		s[0] = t[0];
+		s[1] = t[1];
+		s[2] = t[2];
+		s[3] = t[3];
+	}
+
+#	if GLM_LANG & GLM_LANG_CXX11_FLAG
+	namespace detail
+	{
+		// The n-th thread to draw starts n jumps past the default stream, so
+		// unseeded threads never share or overlap a sequence.
+		GLM_FUNC_QUALIFIER xoshiro256pp thread_engine()
+		{
+			static std::atomic<unsigned int> NextThread(0);
+
+			xoshiro256pp Engine;
+			for(unsigned int i = NextThread++; i > 0; --i)
+				Engine.jump();
+			return Engine;
+		}
+	}//namespace detail
+#	endif
+
+	GLM_FUNC_QUALIFIER xoshiro256pp& randomEngine()
+	{
+#		if GLM_LANG & GLM_LANG_CXX11_FLAG
+			static thread_local xoshiro256pp Engine(detail::thread_engine());
+#		else
+			static xoshiro256pp Engine;
+#		endif
+		return Engine;
+	}
+
+	GLM_FUNC_QUALIFIER void seedRandom(uint64 Seed)
+	{
+		randomEngine().seed(Seed);
+	}
+
+	// Each 64 bit engine output gives two floats: 23 random bits are put in the
+	// mantissa of a float in [1, 2), which is then moved to [Min, Max).
+	template<typename engine>
+	GLM_FUNC_QUALIFIER void linearRandFill(engine& Engine, float* Out, std::size_t Count, float Min, float Max)
+	{
+		float const Range = Max - Min;
+		std::size_t i = 0;
+
+#		if GLM_ARCH & GLM_ARCH_SSE2_BIT
+			__m128i const One = _mm_set1_epi32(0x3F800000);
+			__m128 const OneF = _mm_set1_ps(1.0f);
+			__m128 const RangeV = _mm_set1_ps(Range);
+			__m128 const MinV = _mm_set1_ps(Min);
+
+			for(; i + 4 <= Count; i += 4)
+			{
+				uint64 const a = Engine();
+				uint64 const b = Engine();
+				__m128i const Bits = _mm_or_si128(_mm_srli_epi32(_mm_set_epi64x(static_cast<long long>(b), static_cast<long long>(a)), 9), One);
+				__m128 const Unit = _mm_sub_ps(_mm_castsi128_ps(Bits), OneF);
+				_mm_storeu_ps(Out + i, _mm_add_ps(_mm_mul_ps(Unit, RangeV), MinV));
+			}
+#		endif
+
+		for(; i < Count; i += 2)
+		{
+			uint64 const r = Engine();
+			uint32 const Bits[2] = {
+				(static_cast<uint32>(r) >> 9) | 0x3F800000u,
+				(static_cast<uint32>(r >> 32) >> 9) | 0x3F800000u};
+
+			for(std::size_t j = 0; j < 2 && i + j < Count; ++j)
+			{
+				float Unit;
+				std::memcpy(&Unit, &Bits[j], sizeof(Unit));
+				Out[i + j] = (Unit - 1.0f) * Range + Min;
+			}
+		}
+	}
+
+	template<typename engine, length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void linearRandFill(engine& Engine, vec<L, float, Q>* Out, std::size_t Count, vec<L, float, Q> const& Min, vec<L, float, Q> const& Max)
+	{
+		vec<L, float, Q> const Range = Max - Min;
+
+		if(sizeof(vec<L, float, Q>) == sizeof(float) * L)
+		{
+			linearRandFill(Engine, &Out[0][0], Count * L, 0.0f, 1.0f);
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = Out[i] * Range + Min;
+		}
+		else // padded aligned types
+		{
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				float Unit[L];
+				linearRandFill(Engine, Unit, L, 0.0f, 1.0f);
+				for(length_t c = 0; c < L; ++c)
+					Out[i][c] = Unit[c] * Range[c] + Min[c];
+			}
+		}
+	}
 }//namespace glm
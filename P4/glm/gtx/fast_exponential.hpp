@@ -15,6 +15,7 @@
 
 // Dependency:
 #include "../glm.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -89,6 +90,17 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> fastLog2(vec<L, T, Q> const& x);
 
+	/// Writes exp(x[i]) to out[i], several values per instruction on SSE2 and AVX.
+	/// Within 1 ULP of the correctly rounded result where that is a normal float;
+	/// overflows to inf and underflows through the denormals like std::exp.
+	/// @see gtx_fast_exponential
+	GLM_FUNC_DECL void fastExpArray(float const* x, float* out, std::size_t count);
+
+	/// Writes log(x[i]) to out[i], within 1 ULP of the correctly rounded result
+	/// for positive x, denormals included. 0 gives -inf and negative x NaN, like std::log.
+	/// @see gtx_fast_exponential
+	GLM_FUNC_DECL void fastLogArray(float const* x, float* out, std::size_t count);
+
 	/// @}
 }//namespace glm
 
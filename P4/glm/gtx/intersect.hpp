@@ -14,7 +14,9 @@
 #pragma once
 
 // Dependency:
+#include <cassert>
 #include <cfloat>
+#include <cstddef>
 #include <limits>
 #include "../glm.hpp"
 #include "../geometric.hpp"
@@ -86,6 +88,43 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1,
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersection of a ray and an axis aligned box with the slab method.
+	//! distance is the entry distance along dir, 0 when orig is inside the box.
+	//! A ray running in a face plane (zero dir component, orig on boxMin or boxMax) touches the box.
+	//! Works for vec2 and vec3.
+	//! From GLM_GTX_intersect extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayAABB(
+		vec<L, T, Q> const& orig, vec<L, T, Q> const& dir,
+		vec<L, T, Q> const& boxMin, vec<L, T, Q> const& boxMax,
+		T & distance);
+
+	//! Test one ray against count boxes stored as structure of arrays
+	//! (minX[i], minY[i], ... maxZ[i]), 8 boxes at a time with AVX, 4 with SSE2.
+	//! Bit i % 32 of hitMask[i / 32] is set when box i is entered within [0, maxDistance],
+	//! and distances[i] (optional) then holds the entry distance.
+	//! Pass NULL for minZ and maxZ to test 2D boxes, the ray z is then ignored.
+	//! Face planes count as inside, as in intersectRayAABB.
+	//! Returns the number of boxes hit.
+	//! From GLM_GTX_intersect extension.
+	GLM_FUNC_DECL std::size_t intersectRayAABBArray(
+		vec<3, float, defaultp> const& orig, vec<3, float, defaultp> const& dir, float maxDistance,
+		float const* minX, float const* minY, float const* minZ,
+		float const* maxX, float const* maxY, float const* maxZ,
+		std::size_t count, uint32* hitMask, float* distances);
+
+	//! Test a packet of up to 32 rays stored as structure of arrays against one box.
+	//! Returns a mask with bit i set when ray i enters the box within [0, maxDistance];
+	//! distances[i] (optional) then holds the entry distance.
+	//! Pass NULL for origZ and dirZ to test against the 2D box, boxMin.z and boxMax.z are then ignored.
+	//! From GLM_GTX_intersect extension.
+	GLM_FUNC_DECL uint32 intersectRayPacketAABB(
+		float const* origX, float const* origY, float const* origZ,
+		float const* dirX, float const* dirY, float const* dirZ,
+		std::size_t count, float maxDistance,
+		vec<3, float, defaultp> const& boxMin, vec<3, float, defaultp> const& boxMax,
+		float* distances);
+
 	/// @}
 }//namespace glm
 
@@ -15,6 +15,7 @@
 
 // Dependency:
 #include "../mat3x3.hpp"
+#include "../mat3x2.hpp"
 #include "../vec2.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
@@ -75,6 +76,70 @@ namespace glm
 		mat<3, 3, T, Q> const& m,
 		T x);
 
+	/// Builds a translation 2D affine transform created from a vector of 2 components.
+	/// A 3 * 2 matrix holds the x axis, the y axis and the translation of a
+	/// 2D affine transform as its columns: a 3 * 3 matrix without its constant last row.
+	///
+	/// @param m Input transform multiplied by this translation.
+	/// @param v Coordinates of a translation vector.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> translate(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v);
+
+	/// Builds a rotation 2D affine transform created from an angle.
+	///
+	/// @param m Input transform multiplied by this rotation.
+	/// @param angle Rotation angle expressed in radians.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> rotate(
+		mat<3, 2, T, Q> const& m,
+		T angle);
+
+	/// Builds a scale 2D affine transform created from a vector of 2 components.
+	///
+	/// @param m Input transform multiplied by this scale.
+	/// @param v Coordinates of a scale vector.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> scale(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v);
+
+	/// Composes two 2D affine transforms: the result applies b, then a,
+	/// like a * b on the matching 3 * 3 matrices.
+	///
+	/// @param a Outer transform.
+	/// @param b Inner transform.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> compose(
+		mat<3, 2, T, Q> const& a,
+		mat<3, 2, T, Q> const& b);
+
+	/// Inverts a 2D affine transform.
+	///
+	/// @param m Input transform, with a non zero determinant.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> affineInverse(
+		mat<3, 2, T, Q> const& m);
+
+	/// Applies a 2D affine transform to a point.
+	///
+	/// @param m Input transform.
+	/// @param p Point to transform.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> transformPoint(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& p);
+
+	/// Applies the linear part of a 2D affine transform to a direction.
+	///
+	/// @param m Input transform.
+	/// @param v Direction to transform.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> transformVector(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v);
+
 	/// @}
 }//namespace glm
 
@@ -65,4 +65,82 @@ namespace glm
 		return m * Result;
 	}
 
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> translate(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v)
+	{
+		mat<3, 2, T, Q> Result(m);
+		Result[2] = m[0] * v[0] + m[1] * v[1] + m[2];
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> rotate(
+		mat<3, 2, T, Q> const& m,
+		T angle)
+	{
+		T const c = cos(angle);
+		T const s = sin(angle);
+
+		mat<3, 2, T, Q> Result;
+		Result[0] = m[0] * c + m[1] * s;
+		Result[1] = m[0] * -s + m[1] * c;
+		Result[2] = m[2];
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> scale(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v)
+	{
+		mat<3, 2, T, Q> Result;
+		Result[0] = m[0] * v[0];
+		Result[1] = m[1] * v[1];
+		Result[2] = m[2];
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> compose(
+		mat<3, 2, T, Q> const& a,
+		mat<3, 2, T, Q> const& b)
+	{
+		mat<3, 2, T, Q> Result;
+		Result[0] = a[0] * b[0][0] + a[1] * b[0][1];
+		Result[1] = a[0] * b[1][0] + a[1] * b[1][1];
+		Result[2] = a[0] * b[2][0] + a[1] * b[2][1] + a[2];
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 2, T, Q> affineInverse(
+		mat<3, 2, T, Q> const& m)
+	{
+		T const OneOverDeterminant = static_cast<T>(1) / (m[0][0] * m[1][1] - m[1][0] * m[0][1]);
+
+		mat<3, 2, T, Q> Result;
+		Result[0] = vec<2, T, Q>(m[1][1], -m[0][1]) * OneOverDeterminant;
+		Result[1] = vec<2, T, Q>(-m[1][0], m[0][0]) * OneOverDeterminant;
+		Result[2] = -(Result[0] * m[2][0] + Result[1] * m[2][1]);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> transformPoint(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& p)
+	{
+		return m[0] * p[0] + m[1] * p[1] + m[2];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<2, T, Q> transformVector(
+		mat<3, 2, T, Q> const& m,
+		vec<2, T, Q> const& v)
+	{
+		return m[0] * v[0] + m[1] * v[1];
+	}
+
 }//namespace glm
@@ -1,5 +1,6 @@
 /// @ref gtx_quaternion
 
+#include <cstring>
 #include <limits>
 #include "../gtc/constants.hpp"
 
@@ -156,4 +157,203 @@ namespace glm
 			rotationAxis.y * invs,
 			rotationAxis.z * invs);
 	}
+
+namespace detail
+{
+	// One component per lane value, lane_count quaternions or vectors at a time.
+	template<typename V>
+	struct quat_lanes
+	{
+		V x, y, z, w;
+	};
+
+	template<typename V>
+	struct vec3_lanes
+	{
+		V x, y, z;
+	};
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER quat_lanes<V> slerp_lanes(quat_lanes<V> const& x, quat_lanes<V> const& y, V const& a)
+	{
+		V const d = x.x * y.x + x.y * y.y + x.z * y.z + x.w * y.w;
+		V const c = lane_abs(d);
+
+		// (1 - c) is exact near c = 1, where 1 - c * c would lose most of its bits.
+		V const s = lane_sqrt(lane_max((V(1.0f) - c) * (V(1.0f) + c), V(0.0f)));
+		V const angle = atan2_lanes(s, c);
+		V wx = sin_lanes((V(1.0f) - a) * angle) / s;
+		V wy = sin_lanes(a * angle) / s;
+
+		typename lane_mask<V>::type const linear = lane_gt(c, V(1.0f - std::numeric_limits<float>::epsilon()));
+		wx = lane_select(linear, V(1.0f) - a, wx);
+		wy = lane_select(linear, a, wy);
+		wy = lane_select(lane_lt(d, V(0.0f)), -wy, wy);
+
+		quat_lanes<V> r;
+		r.x = x.x * wx + y.x * wy;
+		r.y = x.y * wx + y.y * wy;
+		r.z = x.z * wx + y.z * wy;
+		r.w = x.w * wx + y.w * wy;
+		return r;
+	}
+
+	// The scalar path uses the scalar functions; the lane kernels only pay off several lanes at a time.
+	template<>
+	GLM_FUNC_QUALIFIER quat_lanes<float> slerp_lanes(quat_lanes<float> const& x, quat_lanes<float> const& y, float const& a)
+	{
+		qua<float, defaultp> const r = slerp(qua<float, defaultp>(x.w, x.x, x.y, x.z), qua<float, defaultp>(y.w, y.x, y.y, y.z), a);
+		quat_lanes<float> const Result = {r.x, r.y, r.z, r.w};
+		return Result;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER quat_lanes<V> nlerp_lanes(quat_lanes<V> const& x, quat_lanes<V> const& y, V const& a)
+	{
+		V const d = x.x * y.x + x.y * y.y + x.z * y.z + x.w * y.w;
+		V const wx = V(1.0f) - a;
+		V const wy = lane_select(lane_lt(d, V(0.0f)), -a, a);
+
+		quat_lanes<V> m;
+		m.x = x.x * wx + y.x * wy;
+		m.y = x.y * wx + y.y * wy;
+		m.z = x.z * wx + y.z * wy;
+		m.w = x.w * wx + y.w * wy;
+
+		// Same zero length fallback as normalize: the identity quaternion.
+		V const len = lane_sqrt(m.x * m.x + m.y * m.y + m.z * m.z + m.w * m.w);
+		typename lane_mask<V>::type const zero = lane_le(len, V(0.0f));
+		V const inv = V(1.0f) / len;
+
+		quat_lanes<V> r;
+		r.x = lane_select(zero, V(0.0f), m.x * inv);
+		r.y = lane_select(zero, V(0.0f), m.y * inv);
+		r.z = lane_select(zero, V(0.0f), m.z * inv);
+		r.w = lane_select(zero, V(1.0f), m.w * inv);
+		return r;
+	}
+
+	template<>
+	GLM_FUNC_QUALIFIER quat_lanes<float> nlerp_lanes(quat_lanes<float> const& x, quat_lanes<float> const& y, float const& a)
+	{
+		qua<float, defaultp> const qx(x.w, x.x, x.y, x.z);
+		qua<float, defaultp> const qy(y.w, y.x, y.y, y.z);
+		qua<float, defaultp> const r = normalize(lerp(qx, dot(qx, qy) < 0.0f ? -qy : qy, a));
+		quat_lanes<float> const Result = {r.x, r.y, r.z, r.w};
+		return Result;
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER vec3_lanes<V> rotate_lanes(quat_lanes<V> const& q, vec3_lanes<V> const& v)
+	{
+		V const uvx = q.y * v.z - q.z * v.y;
+		V const uvy = q.z * v.x - q.x * v.z;
+		V const uvz = q.x * v.y - q.y * v.x;
+		V const uuvx = q.y * uvz - q.z * uvy;
+		V const uuvy = q.z * uvx - q.x * uvz;
+		V const uuvz = q.x * uvy - q.y * uvx;
+
+		vec3_lanes<V> r;
+		r.x = v.x + (uvx * q.w + uuvx) * V(2.0f);
+		r.y = v.y + (uvy * q.w + uuvy) * V(2.0f);
+		r.z = v.z + (uvz * q.w + uuvz) * V(2.0f);
+		return r;
+	}
+
+	GLM_FUNC_QUALIFIER quat_lanes<lanes> load_quat_lanes(float const* p)
+	{
+		quat_lanes<lanes> q;
+		lane_load4(p, q.x, q.y, q.z, q.w);
+		return q;
+	}
+
+	GLM_FUNC_QUALIFIER void store_quat_lanes(float* p, quat_lanes<lanes> const& q)
+	{
+		lane_store4(p, q.x, q.y, q.z, q.w);
+	}
+
+	// Aligned vec3 is padded to 16 bytes, packed vec3 is 12.
+	template<std::size_t Size>
+	GLM_FUNC_QUALIFIER vec3_lanes<lanes> load_vec3_lanes(float const* p)
+	{
+		vec3_lanes<lanes> v;
+		if(Size == 4 * sizeof(float))
+		{
+			lanes w;
+			lane_load4(p, v.x, v.y, v.z, w);
+		}
+		else
+			lane_load3(p, v.x, v.y, v.z);
+		return v;
+	}
+
+	template<std::size_t Size>
+	GLM_FUNC_QUALIFIER void store_vec3_lanes(float* p, vec3_lanes<lanes> const& v)
+	{
+		if(Size == 4 * sizeof(float))
+			lane_store4(p, v.x, v.y, v.z, lanes(0.0f));
+		else
+			lane_store3(p, v.x, v.y, v.z);
+	}
+
+	typedef quat_lanes<lanes> (*quat_lanes_func2)(quat_lanes<lanes> const&, quat_lanes<lanes> const&, lanes const&);
+
+	// out[i] = Func(x[i], y[i], a[i]) over arrays of packed or aligned quaternions,
+	// which both store x, y, z, w in 16 bytes. The tail runs on a zero padded copy.
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void quat_lanes_transform(quat_lanes_func2 Func, qua<float, Q> const* x, qua<float, Q> const* y, float const* a, qua<float, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<float, Q>) == 4 * sizeof(float), "quat_lanes_transform expects four tightly packed floats per quaternion");
+
+		std::size_t const N = lane_count;
+
+		std::size_t i = 0;
+		for(; i < count / N * N; i += N)
+			store_quat_lanes(&out[i].x, Func(load_quat_lanes(&x[i].x), load_quat_lanes(&y[i].x), lane_load<lanes>(a + i)));
+
+		if(i < count)
+		{
+			float bx[N * 4] = {0}, by[N * 4] = {0}, ba[N] = {0};
+			std::memcpy(bx, x + i, (count - i) * sizeof(qua<float, Q>));
+			std::memcpy(by, y + i, (count - i) * sizeof(qua<float, Q>));
+			std::memcpy(ba, a + i, (count - i) * sizeof(float));
+			store_quat_lanes(bx, Func(load_quat_lanes(bx), load_quat_lanes(by), lane_load<lanes>(ba)));
+			std::memcpy(out + i, bx, (count - i) * sizeof(qua<float, Q>));
+		}
+	}
+}//namespace detail
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void slerpArray(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, qua<float, Q>* out, std::size_t count)
+	{
+		detail::quat_lanes_transform(detail::slerp_lanes<detail::lanes>, x, y, a, out, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerpArray(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, qua<float, Q>* out, std::size_t count)
+	{
+		detail::quat_lanes_transform(detail::nlerp_lanes<detail::lanes>, x, y, a, out, count);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void rotateArray(qua<float, Q> const* q, vec<3, float, Q> const* v, vec<3, float, Q>* out, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(sizeof(qua<float, Q>) == 4 * sizeof(float), "rotateArray expects four tightly packed floats per quaternion");
+
+		std::size_t const N = detail::lane_count;
+		std::size_t const S = sizeof(vec<3, float, Q>);
+
+		std::size_t i = 0;
+		for(; i < count / N * N; i += N)
+			detail::store_vec3_lanes<S>(&out[i].x, detail::rotate_lanes(detail::load_quat_lanes(&q[i].x), detail::load_vec3_lanes<S>(&v[i].x)));
+
+		if(i < count)
+		{
+			float bq[N * 4] = {0}, bv[N * 4] = {0};
+			std::memcpy(bq, q + i, (count - i) * sizeof(qua<float, Q>));
+			std::memcpy(bv, v + i, (count - i) * S);
+			detail::store_vec3_lanes<S>(bv, detail::rotate_lanes(detail::load_quat_lanes(bq), detail::load_vec3_lanes<S>(bv)));
+			std::memcpy(out + i, bv, (count - i) * S);
+		}
+	}
 }//namespace glm
@@ -78,7 +78,15 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_normalize(glm_vec4 v)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(v, v);
 	glm_vec4 const isr0 = _mm_rsqrt_ps(dot0);
-	glm_vec4 const mul0 = _mm_mul_ps(v, isr0);
+#	ifdef GLM_SIMD_FMA
+		// One Newton-Raphson step takes rsqrt from ~12 to ~22 bits of precision.
+		glm_vec4 const hlf0 = _mm_mul_ps(dot0, _mm_set1_ps(0.5f));
+		glm_vec4 const sqr0 = _mm_mul_ps(isr0, isr0);
+		glm_vec4 const nr0 = _mm_fnmadd_ps(hlf0, sqr0, _mm_set1_ps(1.5f));
+		glm_vec4 const mul0 = _mm_mul_ps(v, _mm_mul_ps(isr0, nr0));
+#	else
+		glm_vec4 const mul0 = _mm_mul_ps(v, isr0);
+#	endif
 	return mul0;
 }
 
@@ -95,8 +103,12 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_reflect(glm_vec4 I, glm_vec4 N)
 {
 	glm_vec4 const dot0 = glm_vec4_dot(N, I);
 	glm_vec4 const mul0 = _mm_mul_ps(N, dot0);
-	glm_vec4 const mul1 = _mm_mul_ps(mul0, _mm_set1_ps(2.0f));
-	glm_vec4 const sub0 = _mm_sub_ps(I, mul1);
+#	ifdef GLM_SIMD_FMA
+		glm_vec4 const sub0 = _mm_fnmadd_ps(mul0, _mm_set1_ps(2.0f), I);
+#	else
+		glm_vec4 const mul1 = _mm_mul_ps(mul0, _mm_set1_ps(2.0f));
+		glm_vec4 const sub0 = _mm_sub_ps(I, mul1);
+#	endif
 	return sub0;
 }
 
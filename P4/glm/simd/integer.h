@@ -112,4 +112,45 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+// Interleaves the low 16 bits of each 32-bit lane of x and y, x in the even bits.
+GLM_FUNC_QUALIFIER glm_uvec4 glm_u32vec4_interleave16(glm_uvec4 x, glm_uvec4 y)
+{
+	glm_uvec4 const Mask3 = _mm_set1_epi32(0x00FF00FF);
+	glm_uvec4 const Mask2 = _mm_set1_epi32(0x0F0F0F0F);
+	glm_uvec4 const Mask1 = _mm_set1_epi32(0x33333333);
+	glm_uvec4 const Mask0 = _mm_set1_epi32(0x55555555);
+
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(x, 8), x), Mask3);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(y, 8), y), Mask3);
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(x, 4), x), Mask2);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(y, 4), y), Mask2);
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(x, 2), x), Mask1);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(y, 2), y), Mask1);
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(x, 1), x), Mask0);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi32(y, 1), y), Mask0);
+
+	return _mm_or_si128(x, _mm_slli_epi32(y, 1));
+}
+
+// Inverse of glm_u32vec4_interleave16: the even bits of v go to x, the odd bits to y.
+GLM_FUNC_QUALIFIER void glm_u32vec4_deinterleave16(glm_uvec4 v, glm_uvec4& x, glm_uvec4& y)
+{
+	glm_uvec4 const Mask4 = _mm_set1_epi32(0x0000FFFF);
+	glm_uvec4 const Mask3 = _mm_set1_epi32(0x00FF00FF);
+	glm_uvec4 const Mask2 = _mm_set1_epi32(0x0F0F0F0F);
+	glm_uvec4 const Mask1 = _mm_set1_epi32(0x33333333);
+	glm_uvec4 const Mask0 = _mm_set1_epi32(0x55555555);
+
+	x = _mm_and_si128(v, Mask0);
+	y = _mm_and_si128(_mm_srli_epi32(v, 1), Mask0);
+	x = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(x, 1), x), Mask1);
+	y = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(y, 1), y), Mask1);
+	x = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(x, 2), x), Mask2);
+	y = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(y, 2), y), Mask2);
+	x = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(x, 4), x), Mask3);
+	y = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(y, 4), y), Mask3);
+	x = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(x, 8), x), Mask4);
+	y = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(y, 8), y), Mask4);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -15,17 +15,39 @@
 #include "stb_image.h"
 
 #include<vector>
+#include <cstring>
+#include <algorithm>
 
 #include "Entity.h"
+#include "Input.h"
+#include "Snapshot.h"
+#include "AI.h"
+#include "Animation.h"
+#include "Broadphase.h"
+#include "FlowField.h"
+#include "UpdateScheduler.h"
+#include "Sleep.h"
+#include "Transform.h"
+#include "Projectile.h"
+#include "Particles.h"
+#include "Scene.h"
+#include "Text.h"
+#include "RenderThread.h"
 
 #define PLATFORM_COUNT 15
 #define ENEMY_COUNT 3
+#define ENTITY_COUNT (1 + PLATFORM_COUNT + ENEMY_COUNT)
 
-struct GameState {
-    Entity *player;
-    Entity *platforms;
-    Entity *enemies;
-};
+// Tiles of the flow field the punchers chase the player with, covering the view.
+#define FLOW_TILE_SIZE 0.25f
+#define FLOW_WIDTH 40
+#define FLOW_HEIGHT 30
+
+#define ROLLBACK_COUNT 8
+#define ROLLBACK_INTERVAL 60
+
+// How far back R seeks a replay, in steps.
+#define REWIND_STEPS 300
 
 GameState state;
 
@@ -35,13 +57,60 @@ GameStatus status = SLEEPING;
 bool isRunning = false;
 
 SDL_Window* displayWindow;
+SDL_GLContext glContext;
 bool gameIsRunning = true;
 
 ShaderProgram program;
+ShaderProgram bulletProgram;
+ShaderProgram particleProgram;
 glm::mat4 viewMatrix, modelMatrix, projectionMatrix;
 
 GLuint platformTextureID, enemy1TextureID, enemy2TextureID, enemy3TextureID, fontTextureID;
 
+InputSystem input;
+
+AISystem ai;
+
+SweepAndPrune broadphase;
+
+FlowField flowField;
+
+UpdateScheduler scheduler;
+
+SleepSystem sleepSystem;
+
+TransformSystem transforms;
+
+ProjectileSystem projectiles;
+
+// Sparks from stomps and hits; only drawn, never simulated against.
+ParticleSystem sparks;
+
+SnapshotRing startSnapshot;
+
+// The entity block every ROLLBACK_INTERVAL steps, and by ring slot the
+// rest of the simulation state that goes with it.
+SnapshotRing rollback;
+struct RollbackState {
+    InputState input;
+    ProjectileState bullets;
+    ParticleState sparks;
+};
+RollbackState rollbackStates[ROLLBACK_COUNT];
+
+// With -renderthread, drawing and swapping move to their own thread and the
+// main loop only simulates and publishes frames.
+RenderThread renderThread;
+bool threadedRender = false;
+
+// The two lines of text shown for each status; RUNNING shows none.
+const char *statusText[][2] = {
+    { "Congrats! You won the battle!", "Press B to battle again" },
+    { "Oh no! You loss the battle!", "Press B to battle again" },
+    { "Defeat your opponents! Good luck!", "Press B to begin battle" },
+    { NULL, NULL },
+};
+
 GLuint LoadTexture(const char* filePath) {
     int w, h, n;
     unsigned char* image = stbi_load(filePath, &w, &h, &n, STBI_rgb_alpha);
@@ -63,64 +132,11 @@ GLuint LoadTexture(const char* filePath) {
     return textureID;
 }
 
-void DrawText(ShaderProgram *program, GLuint fontTextureID, std::string text, float size, float spacing, glm::vec3 position){
-    float width = 1.0f / 16.0f;
-    float height = 1.0f / 16.0f;
-    
-    std::vector<float> vertices;
-    std::vector<float> texCoords;
-    
-    for(int i = 0; i < text.size(); i++) {
-        int index = (int)text[i];
-        float offset = (size + spacing) * i;
-        
-        float u = (float)(index % 16) / 16.0f;
-        float v = (float)(index / 16) / 16.0f;
-        
-        vertices.insert(vertices.end(), {
-            offset + (-0.5f * size), 0.5f * size,
-            offset + (-0.5f * size), -0.5f * size,
-            offset + (0.5f * size), 0.5f * size,
-            offset + (0.5f * size), -0.5f * size,
-            offset + (0.5f * size), 0.5f * size,
-            offset + (-0.5f * size), -0.5f * size,
-        });
-        
-        texCoords.insert(texCoords.end(), {
-            u, v,
-            u, v + height,
-            u + width, v,
-            u + width, v + height,
-            u + width, v,
-            u, v + height,
-        });
-        
-    } // end of for loop
-    
-    glm::mat4 modelMatrix = glm::mat4(1.0f);
-    modelMatrix = glm::translate(modelMatrix, position);
-    program->SetModelMatrix(modelMatrix);
-    
-    glUseProgram(program->programID);
-    
-    glVertexAttribPointer(program->positionAttribute, 2, GL_FLOAT, false, 0, vertices.data());
-    glEnableVertexAttribArray(program->positionAttribute);
-    
-    glVertexAttribPointer(program->texCoordAttribute, 2, GL_FLOAT, false, 0, texCoords.data());
-    glEnableVertexAttribArray(program->texCoordAttribute);
-    
-    glBindTexture(GL_TEXTURE_2D, fontTextureID);
-    glDrawArrays(GL_TRIANGLES, 0, (int)(text.size() * 6));
-    
-    glDisableVertexAttribArray(program->positionAttribute);
-    glDisableVertexAttribArray(program->texCoordAttribute);
-}
-
 void Initialize() {
     SDL_Init(SDL_INIT_VIDEO);
     displayWindow = SDL_CreateWindow("BATTLE!", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 640, 480, SDL_WINDOW_OPENGL);
-    SDL_GLContext context = SDL_GL_CreateContext(displayWindow);
-    SDL_GL_MakeCurrent(displayWindow, context);
+    glContext = SDL_GL_CreateContext(displayWindow);
+    SDL_GL_MakeCurrent(displayWindow, glContext);
     
 #ifdef _WINDOWS
     glewInit();
@@ -137,6 +153,21 @@ void Initialize() {
     program.SetProjectionMatrix(projectionMatrix);
     program.SetViewMatrix(viewMatrix);
     
+    bulletProgram.Load("shaders/vertex_instanced.glsl", "shaders/fragment.glsl");
+    bulletProgram.SetProjectionMatrix(projectionMatrix);
+    bulletProgram.SetViewMatrix(viewMatrix);
+    bulletProgram.SetColor(1.0f, 0.8f, 0.2f, 1.0f);
+    
+    particleProgram.Load("shaders/vertex_particle.glsl", "shaders/fragment_particle.glsl");
+    particleProgram.SetProjectionMatrix(projectionMatrix);
+    particleProgram.SetViewMatrix(viewMatrix);
+    particleProgram.SetColor(1.0f, 0.9f, 0.5f, 1.0f);
+    
+    sparks.Init(4096, 0.5f);
+    sparks.gravity = glm::vec2(0, -9.81f);
+    
+    scheduler.SetView(glm::vec2(-5.0f, -3.75f), glm::vec2(5.0f, 3.75f));
+    
     glUseProgram(program.programID);
     
     glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
@@ -148,7 +179,9 @@ void Initialize() {
     // Initialize Game Objects
     
     // Initialize Player
-    state.player = new Entity();
+    state.entities = new Entity[ENTITY_COUNT];
+    
+    state.player = &state.entities[0];
     state.player->entityType = PLAYER;
     state.player->position = glm::vec3(-4, -1, 0);
     state.player->movement = glm::vec3(0);
@@ -157,17 +190,17 @@ void Initialize() {
     state.player->textureID = LoadTexture("main.jpg");
     
     /*
-    state.player->animRight = new int[4] {3, 7, 11, 15};
-    state.player->animLeft = new int[4] {1, 5, 9, 13};
-    state.player->animUp = new int[4] {2, 6, 10, 14};
-    state.player->animDown = new int[4] {0, 4, 8, 12};
-
-    state.player->animIndices = state.player->animRight;
-    state.player->animFrames = 4;
-    state.player->animIndex = 0;
-    state.player->animTime = 0;
-    state.player->animCols = 4;
-    state.player->animRows = 4;
+    int playerAtlas = animations.AddAtlas(4, 4);
+    int right[] = {3, 7, 11, 15};
+    int left[] = {1, 5, 9, 13};
+    int up[] = {2, 6, 10, 14};
+    int down[] = {0, 4, 8, 12};
+    state.player->animRight = animations.AddClip(playerAtlas, right, 4);
+    state.player->animLeft = animations.AddClip(playerAtlas, left, 4);
+    state.player->animUp = animations.AddClip(playerAtlas, up, 4);
+    state.player->animDown = animations.AddClip(playerAtlas, down, 4);
+
+    state.player->animClip = state.player->animRight;
      */
     
     state.player->height = 0.8f;
@@ -175,7 +208,7 @@ void Initialize() {
     
     state.player->jumpPower = 5.0f;
     
-    state.platforms = new Entity[PLATFORM_COUNT];
+    state.platforms = state.entities + 1;
     GLuint platformTextureID = LoadTexture("stone.png");
 
     for(int i = 0; i < PLATFORM_COUNT - 4; i++){
@@ -200,17 +233,19 @@ void Initialize() {
     state.platforms[14].textureID = platformTextureID;
     state.platforms[14].position = glm::vec3(2, 0.25f, 0);
 
+    // Platforms never move, so they sleep from the start.
     for (int i = 0; i<PLATFORM_COUNT; i++){
-        state.platforms[i].Update(0, NULL, NULL, 0, NULL, 0);
+        state.platforms[i].isSleeping = true;
     }
     
-    state.enemies = new Entity[ENEMY_COUNT];
+    state.enemies = state.platforms + PLATFORM_COUNT;
     GLuint enemy1TextureID = LoadTexture("side1.jpg");
     
     state.enemies[0].entityType = ENEMY;
     state.enemies[0].textureID = enemy1TextureID;
     state.enemies[0].position = glm::vec3(4, -2.45, 0);
     state.enemies[0].speed = 0.5;
+    state.enemies[0].acceleration = glm::vec3(0, -9.81f, 0);
     
     state.enemies[0].aiType = STABBER;
     state.enemies[0].aiState = WALKING;
@@ -221,6 +256,7 @@ void Initialize() {
     state.enemies[1].textureID = enemy2TextureID;
     state.enemies[1].position = glm::vec3(2, -2.45, 0);
     state.enemies[1].speed = 0.5;
+    state.enemies[1].acceleration = glm::vec3(0, -9.81f, 0);
 
     state.enemies[1].aiType = SHOOTER;
     state.enemies[1].aiState = WALKING;
@@ -231,20 +267,93 @@ void Initialize() {
     state.enemies[2].textureID = enemy3TextureID;
     state.enemies[2].position = glm::vec3(0, 1.10, 0);
     state.enemies[2].speed = 0.5;
+    state.enemies[2].acceleration = glm::vec3(0, -9.81f, 0);
     
     state.enemies[2].aiType = PUNCHER;
     state.enemies[2].aiState = WALKING;
     
+    ai.Build(state.enemies, ENEMY_COUNT);
+    
+    flowField.Init(FLOW_WIDTH, FLOW_HEIGHT, RealVec3(-5, -3.75f, 0), FLOW_TILE_SIZE);
+    for (int i = 0; i < PLATFORM_COUNT; i++) {
+        flowField.Block(state.platforms[i].position, state.platforms[i].width, state.platforms[i].height);
+    }
+    ai.field = &flowField;
+    projectiles.Init(PROJECTILE_CAPACITY);
+    ai.projectiles = &projectiles;
+    scheduler.Rebuild(state.entities, ENTITY_COUNT, input.step);
+    transforms.Build(state.entities, ENTITY_COUNT);
+    transforms.Update(state.entities);
+#ifdef FLOW_FIELD_WORKER
+    // Off by default: the worker's timing would make replays diverge.
+    flowField.StartWorker();
+#endif
+    
+    broadphase.Add(state.player);
+    for (int i = 0; i < ENEMY_COUNT; i++) broadphase.Add(&state.enemies[i]);
+    
     fontTextureID = LoadTexture("font1.png");
+    
+    startSnapshot.Init(state.entities, sizeof(Entity) * ENTITY_COUNT, 1);
+    startSnapshot.Save(0);
+    rollback.Init(state.entities, sizeof(Entity) * ENTITY_COUNT, ROLLBACK_COUNT);
  
 }
 
-void ProcessInput() {
+void Restart() {
+    startSnapshot.Restore(0, NULL);
+    input.Restart();
+    rollback.Clear();
+    scheduler.Rebuild(state.entities, ENTITY_COUNT, input.step);
+    transforms.Build(state.entities, ENTITY_COUNT);
+    sleepSystem.Clear();
+    projectiles.Clear();
+    sparks.Clear();
+    
+    status = RUNNING;
+    isRunning = true;
+}
+
+// Taken at the start of a step, before its input is read.
+void SaveRollback() {
+    rollback.Save(input.step);
+    RollbackState &saved = rollbackStates[rollback.slot];
+    input.SaveState(saved.input);
+    projectiles.SaveState(saved.bullets);
+    sparks.SaveState(saved.sparks);
+}
+
+// Seeks a replay back about REWIND_STEPS steps, to the newest rollback
+// snapshot at or before that. The replay then plays on from there.
+void Rewind() {
+    if (input.mode != INPUT_REPLAYING) return;
     
-    state.player->movement = glm::vec3(0);
+    Uint32 target = input.step > REWIND_STEPS ? input.step - REWIND_STEPS : 0;
+    Uint32 step;
+    if (rollback.RestoreAt(target, &step) == false) return;
+    
+    const RollbackState &saved = rollbackStates[rollback.slot];
+    input.RestoreState(saved.input);
+    projectiles.RestoreState(saved.bullets);
+    sparks.RestoreState(saved.sparks);
+    // The step re-saves its snapshot when the replay gets back to it.
+    rollback.DropFrom(step);
+    
+    scheduler.Rebuild(state.entities, ENTITY_COUNT, step);
+    transforms.Build(state.entities, ENTITY_COUNT);
+    sleepSystem.Clear();
+    
+    status = RUNNING;
+    isRunning = true;
+}
+
+void ProcessInput() {
     
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+        // Game keys go through the input ring so each fixed step sees them once.
+        if (input.PushEvent(event)) continue;
+        
         switch (event.type) {
             case SDL_QUIT:
             case SDL_WINDOWEVENT_CLOSE:
@@ -253,25 +362,14 @@ void ProcessInput() {
                 
             case SDL_KEYDOWN:
                 switch (event.key.keysym.sym) {
-                    case SDLK_LEFT:
-                        // Move the player left
-                        break;
-                        
-                    case SDLK_RIGHT:
-                        // Move the player right
-                        break;
-                        
-                    case SDLK_SPACE:
-                        //if(state.player->collidedBottom){
-                        state.player->jump = true;
-                        //}
-                        break;
                     case SDLK_b:
                         switch (status) {
                             case WINNING:
+                                Restart();
                                 break;
                                         
                             case LOSING:
+                                Restart();
                                 break;
                     
                             case SLEEPING:
@@ -282,27 +380,44 @@ void ProcessInput() {
                             case RUNNING:
                                 break;
                                     
-                        }        
+                        }
+                        break;
+                        
+                    case SDLK_r:
+                        Rewind();
+                        break;
                 }
                 break; // SDL_KEYDOWN
 
         }
     }
     
-    const Uint8 *keys = SDL_GetKeyboardState(NULL);
+    if (isRunning == false) {
+        input.Flush();
+    }
+
+}
+
+void ApplyInput(const InputFrame &frame) {
+    
+    state.player->movement = glm::vec3(0);
 
-    if (keys[SDL_SCANCODE_LEFT]) {
+    if (frame.IsHeld(INPUT_LEFT)) {
         state.player->movement.x = -1.0f;
-        state.player->animIndices = state.player->animLeft;
+        state.player->animClip = state.player->animLeft;
     }
-    else if (keys[SDL_SCANCODE_RIGHT]) {
+    else if (frame.IsHeld(INPUT_RIGHT)) {
         state.player->movement.x = 1.0f;
-        state.player->animIndices = state.player->animRight;
+        state.player->animClip = state.player->animRight;
     }
-
-    if (glm::length(state.player->movement) > 1.0f) {
-        state.player->movement = glm::normalize(state.player->movement);
+    
+    if (frame.WasPressed(INPUT_JUMP)) {
+        //if(state.player->collidedBottom){
+        state.player->jump = true;
+        //}
     }
+    
+    if (frame.held != 0 || frame.pressed != 0) sleepSystem.Wake(state.player);
 
 }
 
@@ -310,7 +425,26 @@ void ProcessInput() {
 float lastTicks = 0;
 float accumulator = 0.0f;
 
-void Update() {
+// Player vs enemy resolution for the pairs the broadphase found this step.
+void ResolvePairs() {
+    broadphase.Update();
+    sleepSystem.WakeContacts(broadphase.pairs);
+    for (size_t i = 0; i < broadphase.pairs.size(); i++) {
+        Entity *a = broadphase.pairs[i].a;
+        Entity *b = broadphase.pairs[i].b;
+        if (b->entityType == PLAYER) std::swap(a, b);
+        if (a->entityType != PLAYER || b->entityType != ENEMY) continue;
+        
+        bool wasActive = b->isActive;
+        a->JumpEnemy(b);
+        if (wasActive && b->isActive == false) sparks.Burst(glm::vec2(glm::vec3(b->position)), 64, 3.0f);
+    }
+}
+
+// Returns the number of fixed steps it ran.
+int Update() {
+    
+    int stepCount = 0;
     
     if (isRunning == true) {
         float ticks = (float)SDL_GetTicks() / 1000.0f;
@@ -322,18 +456,50 @@ void Update() {
         deltaTime += accumulator;
         if (deltaTime < FIXED_TIMESTEP) {
             accumulator = deltaTime;
-            return;
+            return 0;
         }
         
+        float stepEnd = ticks - deltaTime;
+        
         while (deltaTime >= FIXED_TIMESTEP) {
+            stepEnd += FIXED_TIMESTEP;
+            if (input.step % ROLLBACK_INTERVAL == 0) {
+                SaveRollback();
+            }
+            InputFrame frame = input.NextFrame((Uint32)(stepEnd * 1000.0f));
+            ApplyInput(frame);
+            sleepSystem.Flush();
+            
             // Update. Notice it's FIXED_TIMESTEP. Not deltaTime
-            state.player->Update(FIXED_TIMESTEP, state.player, state.platforms, PLATFORM_COUNT, state.enemies, ENEMY_COUNT);
+            state.player->Update(FIXED_TIMESTEP, state.platforms, PLATFORM_COUNT, NULL, 0);
+            ResolvePairs();
+            
+            flowField.Follow(state.player->position);
+            
+            // Enemies far from the view run every few steps with the time they missed.
+            scheduler.Begin(state.entities, frame.step, FIXED_TIMESTEP);
+            ai.Update(state.player);
             
             for (int i = 0; i < ENEMY_COUNT; i++){
-                state.enemies[i].Update(FIXED_TIMESTEP, state.player, state.platforms, PLATFORM_COUNT, state.enemies, ENEMY_COUNT);
+                if (state.enemies[i].updateDue == false) continue;
+                state.enemies[i].Update(state.enemies[i].updateTime, state.platforms, PLATFORM_COUNT, state.enemies, ENEMY_COUNT);
+            }
+            
+            animations.Advance(state.entities, ENTITY_COUNT);
+            scheduler.End();
+            
+            if (projectiles.Update(FIXED_TIMESTEP, flowField.blocked, flowField.origin, flowField.tileSize, state.player)) {
+                state.player->isDead = true;
+                sparks.Burst(glm::vec2(glm::vec3(state.player->position)), 64, 3.0f);
             }
+            sparks.Update(FIXED_TIMESTEP);
+            
+            // Contacts found this step wake their sleepers now, so the wake
+            // list is always empty when a snapshot is taken.
+            sleepSystem.Flush();
             
             deltaTime -= FIXED_TIMESTEP;
+            stepCount++;
             
             for (int i=0; i < ENEMY_COUNT; i++){
                 if (state.enemies[i].isActive == true){
@@ -355,11 +521,20 @@ void Update() {
         accumulator = deltaTime;
         
     }
+    else {
+        // Don't let time spent on the menus turn into a burst of steps.
+        lastTicks = (float)SDL_GetTicks() / 1000.0f;
+        accumulator = 0.0f;
+    }
     
+    return stepCount;
 }
 
 void Render() {
     glClear(GL_COLOR_BUFFER_BIT);
+    
+    // Only entities that moved since the last frame get new matrices.
+    transforms.Update(state.entities);
 
     for (int i = 0; i<PLATFORM_COUNT; i++){
         state.platforms[i].Render(&program);
@@ -371,41 +546,100 @@ void Render() {
     
     state.player->Render(&program);
     
-    switch(status){
-        case WINNING:
-            DrawText(&program, fontTextureID, "Congrats! You won the battle!", 0.4f, -0.25f, glm::vec3(-2.25, 0, 0));
-            break;
-            
-        case LOSING:
-            DrawText(&program, fontTextureID, "Oh no! You loss the battle!", 0.4f, -0.25f, glm::vec3(-2.25, 0, 0));
-            break;
-            
-        case SLEEPING:
-            DrawText(&program, fontTextureID, "Defeat your opponents! Good luck!", 0.4f, -0.25f, glm::vec3(-2.25, 0, 0));
-            DrawText(&program, fontTextureID, "Press B to begin battle", 0.4f, -0.25f, glm::vec3(-1.25, -1, 0));
-            break;
-        
-        case RUNNING:
-            break;
+    projectiles.Render(&bulletProgram);
+    sparks.Render(&particleProgram);
+    
+    if (status != RUNNING) {
+        DrawText(&program, fontTextureID, statusText[status][0], 0.4f, -0.25f, glm::vec3(-2.25, 0, 0));
+        DrawText(&program, fontTextureID, statusText[status][1], 0.4f, -0.25f, glm::vec3(-1.25, -1, 0));
     }
-
     
     SDL_GL_SwapWindow(displayWindow);
     
 }
 
 
+// Render's threaded counterpart: copies what Render would draw into frame.
+void Capture(RenderFrame &frame) {
+    transforms.Update(state.entities);
+    
+    frame.Clear();
+    for (int i = 0; i<PLATFORM_COUNT; i++) frame.AddSprite(state.platforms[i]);
+    for (int i = 0; i<ENEMY_COUNT; i++) frame.AddSprite(state.enemies[i]);
+    frame.AddSprite(*state.player);
+    
+    frame.SetBullets(projectiles);
+    frame.SetSparks(sparks);
+    
+    if (status != RUNNING) {
+        frame.AddText(statusText[status][0], 0.4f, -0.25f, glm::vec3(-2.25, 0, 0));
+        frame.AddText(statusText[status][1], 0.4f, -0.25f, glm::vec3(-1.25, -1, 0));
+    }
+}
+
+void StartRenderThread() {
+    renderThread.program = &program;
+    renderThread.bulletProgram = &bulletProgram;
+    renderThread.particleProgram = &particleProgram;
+    renderThread.fontTextureID = fontTextureID;
+    
+    Capture(renderThread.Back());
+    renderThread.Publish();
+    
+    // The render thread makes the context current on its side.
+    SDL_GL_MakeCurrent(displayWindow, NULL);
+    renderThread.Start(displayWindow, glContext);
+    threadedRender = true;
+}
+
 void Shutdown() {
+    if (threadedRender) {
+        renderThread.Stop();
+        SDL_GL_MakeCurrent(displayWindow, glContext);
+    }
+    input.Stop();
+    startSnapshot.Free();
+    rollback.Free();
+    flowField.Free();
+    projectiles.Free();
+    sparks.Free();
     SDL_Quit();
 }
 
 int main(int argc, char* argv[]) {
     Initialize();
     
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "-record") == 0) {
+            if (!input.StartRecording(argv[i + 1])) std::cout << "Unable to record input to " << argv[i + 1] << std::endl;
+        }
+        else if (strcmp(argv[i], "-replay") == 0) {
+            if (!input.StartReplay(argv[i + 1])) std::cout << "Unable to replay input from " << argv[i + 1] << std::endl;
+        }
+    }
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-renderthread") == 0) StartRenderThread();
+    }
+    
+    GameStatus shownStatus = status;
     while (gameIsRunning) {
         ProcessInput();
-        Update();
-        Render();
+        if (threadedRender == false) {
+            Update();
+            Render();
+            continue;
+        }
+        
+        // Nothing to publish until a step runs or the menu changes; without
+        // vsync to block on, yield instead of spinning.
+        if (Update() > 0 || status != shownStatus) {
+            Capture(renderThread.Back());
+            renderThread.Publish();
+            shownStatus = status;
+        }
+        else {
+            SDL_Delay(1);
+        }
     }
     
     Shutdown();
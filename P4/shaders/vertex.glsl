@@ -1,11 +1,13 @@
+#version 120
+
 attribute vec4 position;
 
-uniform mat4 modelMatrix;
+uniform mat3x2 modelMatrix;
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
 
 void main()
 {
-	vec4 p = viewMatrix * modelMatrix  * position;
+	vec4 p = viewMatrix * vec4(modelMatrix * vec3(position.xy, 1.0), position.zw);
 	gl_Position = projectionMatrix * p;
 }
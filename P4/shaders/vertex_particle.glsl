@@ -0,0 +1,20 @@
+#version 120
+
+attribute vec4 position;
+attribute float instanceX;
+attribute float instanceY;
+attribute float instanceAlpha;
+
+uniform mat3x2 modelMatrix;
+uniform mat4 viewMatrix;
+uniform mat4 projectionMatrix;
+
+varying float alphaVar;
+
+void main()
+{
+	vec2 world = modelMatrix * vec3(position.xy, 1.0) + vec2(instanceX, instanceY);
+	vec4 p = viewMatrix * vec4(world, position.zw);
+    alphaVar = instanceAlpha;
+	gl_Position = projectionMatrix * p;
+}
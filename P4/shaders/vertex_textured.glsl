@@ -1,7 +1,9 @@
+#version 120
+
 attribute vec4 position;
 attribute vec2 texCoord;
 
-uniform mat4 modelMatrix;
+uniform mat3x2 modelMatrix;
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
 
@@ -9,7 +11,7 @@ varying vec2 texCoordVar;
 
 void main()
 {
-	vec4 p = viewMatrix * modelMatrix  * position;
+	vec4 p = viewMatrix * vec4(modelMatrix * vec3(position.xy, 1.0), position.zw);
     texCoordVar = texCoord;
 	gl_Position = projectionMatrix * p;
 }
\ No newline at end of file